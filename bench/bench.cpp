@@ -0,0 +1,793 @@
+/* clang-format off */
+/*
+ * @file bench.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "algorithm/base/base16.h"
+#include "algorithm/base/base32.h"
+#include "algorithm/base/base58.h"
+#include "algorithm/base/base62.h"
+#include "algorithm/base/base64.h"
+#include "algorithm/base/base85.h"
+#include "algorithm/base/base91.h"
+#include "algorithm/base/base92.h"
+#include "algorithm/base/base100.h"
+#include "algorithm/simple/uucode.h"
+#include "algorithm/simple/xxcode.h"
+#include "algorithm/simple/vigenere.h"
+#include "algorithm/hash/hash.h"
+#include "algorithm/hash/batch_hash.h"
+#include "algorithm/hash/hmac.h"
+#include "algorithm/advance/aes.h"
+#include "algorithm/advance/rsa.h"
+#include "algorithm/common/cpu.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||             \
+        defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+namespace CryptoToysPP::Bench {
+    using Clock = std::chrono::steady_clock;
+    using Operation = std::function<std::string(const std::string &)>;
+
+    // Command line configuration
+    struct Options {
+        size_t minSize = 16;
+        size_t maxSize = size_t{64} << 20; // 64 MiB, up to 1 GiB on request
+        size_t quadraticMaxSize = size_t{16} << 10; // Base58/Base62 cap
+        double minSeconds = 0.2;  // Minimum sampling time per case
+        size_t maxIterations = 10000;
+        size_t minIterations = 3;
+        std::vector<std::string> filters;
+        std::string outputPath; // Empty means stdout
+        bool quiet = false;
+    };
+
+    // One benchmark case: a named operation over an input of a given size
+    struct Case {
+        std::string group;     // codec / hash / cipher
+        std::string name;      // e.g. base64, sha256, aes-cbc-256-PKCS7
+        std::string operation; // encode / decode / digest / encrypt ...
+        size_t maxSize;        // Upper bound for the size sweep
+        std::function<std::string(size_t)> makeInput;
+        Operation run;
+        std::vector<size_t> fixedSizes{}; // Overrides the sweep if non-empty
+    };
+
+    // Read the CPU timestamp counter (reference cycles) where available
+    inline uint64_t ReadCycles() {
+#if BENCH_HAS_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    // Deterministic pseudo-random payload so runs are comparable
+    std::string RandomBytes(size_t size, uint64_t seed = 0x5EED) {
+        std::mt19937_64 rng(seed ^ size);
+        std::string data(size, '\0');
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            const uint64_t v = rng();
+            std::memcpy(data.data() + i, &v, 8);
+        }
+        for (; i < size; ++i) {
+            data[i] = static_cast<char>(rng() & 0xFF);
+        }
+        return data;
+    }
+
+    // Printable payload for text-oriented ciphers such as Vigenere
+    std::string RandomText(size_t size) {
+        static constexpr char ALPHABET[] = "abcdefghijklmnopqrstuvwxyz"
+                                           "ABCDEFGHIJKLMNOPQRSTUVWXYZ ,.";
+        std::mt19937_64 rng(size);
+        std::string data(size, ' ');
+        for (auto &c : data) {
+            c = ALPHABET[rng() % (sizeof(ALPHABET) - 1)];
+        }
+        return data;
+    }
+
+    // Parse sizes such as 4096, 64K, 16M or 1G
+    size_t ParseSize(const std::string &text) {
+        size_t pos = 0;
+        const unsigned long long value = std::stoull(text, &pos);
+        size_t shift = 0;
+        if (pos < text.size()) {
+            switch (std::toupper(static_cast<unsigned char>(text[pos]))) {
+                case 'K':
+                    shift = 10;
+                    break;
+                case 'M':
+                    shift = 20;
+                    break;
+                case 'G':
+                    shift = 30;
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid size: " + text);
+            }
+        }
+        return static_cast<size_t>(value) << shift;
+    }
+
+    std::string FormatSize(size_t size) {
+        if (size >= (size_t{1} << 30) && size % (size_t{1} << 30) == 0)
+            return std::to_string(size >> 30) + "G";
+        if (size >= (size_t{1} << 20) && size % (size_t{1} << 20) == 0)
+            return std::to_string(size >> 20) + "M";
+        if (size >= (size_t{1} << 10) && size % (size_t{1} << 10) == 0)
+            return std::to_string(size >> 10) + "K";
+        return std::to_string(size);
+    }
+
+    // Geometric size sweep: 16 B, 64 B, 256 B, ... (x4 per step)
+    std::vector<size_t> SizeSweep(const Options &options, size_t caseMax) {
+        std::vector<size_t> sizes;
+        const size_t upper = std::min(options.maxSize, caseMax);
+        for (size_t size = options.minSize; size <= upper; size *= 4) {
+            sizes.push_back(size);
+            if (size > upper / 4)
+                break;
+        }
+        return sizes;
+    }
+
+    double Percentile(const std::vector<double> &sorted, double p) {
+        if (sorted.empty())
+            return 0.0;
+        const double rank = p * static_cast<double>(sorted.size() - 1);
+        const auto lo = static_cast<size_t>(rank);
+        const size_t hi = std::min(lo + 1, sorted.size() - 1);
+        const double frac = rank - static_cast<double>(lo);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * frac;
+    }
+
+    // Run one case at one size and collect throughput / latency samples
+    nlohmann::json Measure(const Options &options,
+                           const Case &benchCase,
+                           size_t size) {
+        const std::string input = benchCase.makeInput(size);
+        std::vector<double> latencies;
+        std::vector<double> cycles;
+        size_t outputSize = 0;
+
+        // Warm-up call also validates that the operation works
+        outputSize = benchCase.run(input).size();
+
+        const auto start = Clock::now();
+        while (latencies.size() < options.maxIterations) {
+            const auto t0 = Clock::now();
+            const uint64_t c0 = ReadCycles();
+            const std::string output = benchCase.run(input);
+            const uint64_t c1 = ReadCycles();
+            const auto t1 = Clock::now();
+            outputSize = output.size();
+
+            latencies.push_back(
+                    std::chrono::duration<double, std::nano>(t1 - t0).count());
+            cycles.push_back(static_cast<double>(c1 - c0));
+
+            const double elapsed =
+                    std::chrono::duration<double>(Clock::now() - start)
+                            .count();
+            if (latencies.size() >= options.minIterations &&
+                elapsed >= options.minSeconds)
+                break;
+        }
+
+        double totalNs = 0.0;
+        for (const double ns : latencies)
+            totalNs += ns;
+        std::ranges::sort(latencies);
+        std::ranges::sort(cycles);
+
+        const double iterations = static_cast<double>(latencies.size());
+        const double bytes = static_cast<double>(input.size());
+        const double mbPerSecond =
+                totalNs > 0.0 ? bytes * iterations / (totalNs / 1e9) / 1e6
+                              : 0.0;
+
+        nlohmann::json result = {
+                {"group", benchCase.group},
+                {"name", benchCase.name},
+                {"operation", benchCase.operation},
+                {"input_bytes", input.size()},
+                {"output_bytes", outputSize},
+                {"iterations", latencies.size()},
+                {"mb_per_s", mbPerSecond},
+                {"latency_ns",
+                 {{"min", latencies.front()},
+                  {"p50", Percentile(latencies, 0.50)},
+                  {"p90", Percentile(latencies, 0.90)},
+                  {"p99", Percentile(latencies, 0.99)},
+                  {"max", latencies.back()},
+                  {"mean", totalNs / iterations}}}};
+        if (BENCH_HAS_TSC && !input.empty()) {
+            result["cycles_per_byte"] = Percentile(cycles, 0.50) / bytes;
+        } else {
+            result["cycles_per_byte"] = nullptr;
+        }
+        return result;
+    }
+
+    // Register encode and decode cases for a string-based codec
+    void AddCodec(std::vector<Case> &cases,
+                  const std::string &name,
+                  const Operation &encode,
+                  const Operation &decode,
+                  size_t maxSize = SIZE_MAX) {
+        cases.push_back({"codec", name, "encode", maxSize,
+                         [](size_t size) {
+                             return RandomBytes(size);
+                         },
+                         encode});
+        cases.push_back({"codec", name, "decode", maxSize,
+                         [encode](size_t size) {
+                             return encode(RandomBytes(size));
+                         },
+                         decode});
+    }
+
+    void AddCodecCases(std::vector<Case> &cases, const Options &options) {
+        using namespace Algorithm::Base;
+        using namespace Algorithm::Simple;
+        auto sv = [](auto fn) -> Operation {
+            return [fn](const std::string &data) {
+                return fn(data);
+            };
+        };
+
+        AddCodec(cases, "base16",
+                 sv([](const std::string &d) {
+                     return Base16::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base16::Decode(d);
+                 }));
+        AddCodec(cases, "base32",
+                 sv([](const std::string &d) {
+                     return Base32::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base32::Decode(d);
+                 }));
+        AddCodec(cases, "base32hex",
+                 sv([](const std::string &d) {
+                     return Base32::Encode(d, Base32::Alphabet::HEX);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base32::Decode(d, Base32::Alphabet::HEX);
+                 }));
+        // Base58 / Base62 are big-number conversions (quadratic), so the
+        // sweep is capped separately to keep a default run tractable
+        AddCodec(cases, "base58",
+                 sv([](const std::string &d) {
+                     return Base58::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base58::Decode(d);
+                 }),
+                 options.quadraticMaxSize);
+        AddCodec(cases, "base62",
+                 sv([](const std::string &d) {
+                     return Base62::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base62::Decode(d);
+                 }),
+                 options.quadraticMaxSize);
+        AddCodec(cases, "base64",
+                 sv([](const std::string &d) {
+                     return Base64::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base64::Decode(d);
+                 }));
+        AddCodec(cases, "base64url",
+                 sv([](const std::string &d) {
+                     return Base64::EncodeURL(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base64::DecodeURL(d);
+                 }));
+        AddCodec(cases, "base85",
+                 sv([](const std::string &d) {
+                     return Base85::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base85::Decode(d);
+                 }));
+        AddCodec(cases, "z85",
+                 sv([](const std::string &d) {
+                     return Base85::EncodeZ85(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base85::DecodeZ85(d);
+                 }));
+        AddCodec(cases, "ascii85",
+                 sv([](const std::string &d) {
+                     return Base85::EncodeAscii85(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base85::DecodeAscii85(d);
+                 }));
+        AddCodec(cases, "base91",
+                 sv([](const std::string &d) {
+                     return Base91::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base91::Decode(d);
+                 }));
+        AddCodec(cases, "base92",
+                 sv([](const std::string &d) {
+                     return Base92::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base92::Decode(d);
+                 }));
+        AddCodec(cases, "base100",
+                 sv([](const std::string &d) {
+                     return Base100::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return Base100::Decode(d);
+                 }));
+        AddCodec(cases, "uucode",
+                 sv([](const std::string &d) {
+                     return UUCode::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return UUCode::Decode(d);
+                 }));
+        AddCodec(cases, "xxcode",
+                 sv([](const std::string &d) {
+                     return XXCode::Encode(d);
+                 }),
+                 sv([](const std::string &d) {
+                     return XXCode::Decode(d);
+                 }));
+
+        const std::string key = "CryptoToysPP";
+        cases.push_back({"codec", "vigenere", "encode", SIZE_MAX, RandomText,
+                         [key](const std::string &d) {
+                             return Vigenere::Encode(d, key);
+                         }});
+        cases.push_back({"codec", "vigenere", "decode", SIZE_MAX,
+                         [key](size_t size) {
+                             return Vigenere::Encode(RandomText(size), key);
+                         },
+                         [key](const std::string &d) {
+                             return Vigenere::Decode(d, key);
+                         }});
+    }
+
+    void AddHashCases(std::vector<Case> &cases) {
+        using namespace Algorithm;
+        using Digest = std::string (*)(const std::string &);
+        const std::vector<std::pair<std::string, Digest>> digests = {
+                {"md2", Hash::MD2},           {"md4", Hash::MD4},
+                {"md5", Hash::MD5},           {"sha1", Hash::SHA1},
+                {"sha224", Hash::SHA224},     {"sha256", Hash::SHA256},
+                {"sha384", Hash::SHA384},     {"sha512", Hash::SHA512},
+                {"sha3-224", Hash::SHA3_224}, {"sha3-256", Hash::SHA3_256},
+                {"sha3-384", Hash::SHA3_384}, {"sha3-512", Hash::SHA3_512}};
+        for (const auto &[name, digest] : digests) {
+            cases.push_back({"hash", name, "digest", SIZE_MAX,
+                             [](size_t size) {
+                                 return RandomBytes(size);
+                             },
+                             digest});
+        }
+
+        // The input cut into 48-byte records, hashed as one batch
+        constexpr size_t RECORD_SIZE = 48;
+        const auto records = [](std::string_view data) {
+            std::vector<std::string_view> result;
+            for (size_t i = 0; i < data.size(); i += RECORD_SIZE)
+                result.push_back(data.substr(i, RECORD_SIZE));
+            return result;
+        };
+        using Type = Hash::Hasher::Type;
+        for (const auto type : {Type::MD5, Type::SHA1, Type::SHA256}) {
+            cases.push_back(
+                    {"hash", Hash::Hasher::TypeToString(type), "batch-digest",
+                     SIZE_MAX,
+                     [](size_t size) { return RandomBytes(size); },
+                     [type, records](const std::string &d) {
+                         const std::vector<uint8_t> digests =
+                                 Hash::BatchDigest(type, records(d));
+                         return std::string(digests.begin(), digests.end());
+                     }});
+        }
+
+        // The same records tagged under one key, as for request signing
+        const std::string key = "CryptoToysPP";
+        for (const auto type : {Type::SHA256, Type::SHA512}) {
+            cases.push_back(
+                    {"hash", Hash::Hasher::TypeToString(type), "batch-hmac",
+                     SIZE_MAX,
+                     [](size_t size) { return RandomBytes(size); },
+                     [type, key, records](const std::string &d) {
+                         const std::vector<std::string_view> messages =
+                                 records(d);
+                         std::vector<uint8_t> tags(
+                                 messages.size() *
+                                 Hash::Hasher(type).DigestSize());
+                         Hash::Hmac::BatchDigest(type, key, messages, tags);
+                         return std::string(tags.begin(), tags.end());
+                     }});
+        }
+    }
+
+    void AddAesCases(std::vector<Case> &cases) {
+        using AES = Algorithm::Advance::AES;
+        struct ModeSpec {
+            AES::AESMode mode;
+            std::vector<AES::PaddingScheme> paddings;
+            size_t ivSize;
+        };
+        const std::vector<AES::PaddingScheme> blockPaddings = {
+                AES::PaddingScheme::NONE,
+                AES::PaddingScheme::ZEROS,
+                AES::PaddingScheme::PKCS7,
+                AES::PaddingScheme::ONE_AND_ZEROS,
+                AES::PaddingScheme::W3C,
+                AES::PaddingScheme::DEFAULT};
+        const std::vector<AES::PaddingScheme> noPadding = {
+                AES::PaddingScheme::NONE};
+        const std::vector<ModeSpec> modes = {
+                {AES::AESMode::ECB, blockPaddings, 0},
+                {AES::AESMode::CBC, blockPaddings, 16},
+                {AES::AESMode::OFB, noPadding, 16},
+                {AES::AESMode::CFB, noPadding, 16},
+                {AES::AESMode::XTS, noPadding, 16},
+                {AES::AESMode::CCM, noPadding, 12},
+                {AES::AESMode::EAX, noPadding, 16},
+                {AES::AESMode::GCM, noPadding, 16}};
+        const std::vector<AES::KeyBits> keyBits = {AES::KeyBits::BITS_128,
+                                                   AES::KeyBits::BITS_256};
+
+        for (const auto &spec : modes) {
+            for (const auto bits : keyBits) {
+                for (const auto padding : spec.paddings) {
+                    size_t keySize = static_cast<size_t>(bits) / 8;
+                    if (spec.mode == AES::AESMode::XTS)
+                        keySize *= 2;
+                    const std::string key = RandomBytes(keySize, 0xAE5);
+                    const std::string iv = RandomBytes(spec.ivSize, 0x1F);
+                    const std::string name = "aes-" +
+                            AES::AESModeToString(spec.mode) + "-" +
+                            std::to_string(static_cast<int>(bits)) + "-" +
+                            AES::PaddingSchemeToString(padding);
+                    const AES::AESMode mode = spec.mode;
+
+                    auto encrypt = [=](const std::string &data) {
+                        auto result =
+                                AES::Encrypt(data, mode, padding, bits, key, iv,
+                                             AES::EncodingFormat::NONE);
+                        if (!result.success)
+                            throw std::runtime_error(result.error);
+                        return result.data;
+                    };
+                    auto decrypt = [=](const std::string &data) {
+                        auto result =
+                                AES::Decrypt(data, mode, padding, bits, key, iv,
+                                             AES::EncodingFormat::NONE);
+                        if (!result.success)
+                            throw std::runtime_error(result.error);
+                        return result.data;
+                    };
+                    cases.push_back({"cipher", name, "encrypt", SIZE_MAX,
+                                     [](size_t size) {
+                                         return RandomBytes(size);
+                                     },
+                                     encrypt});
+                    cases.push_back({"cipher", name, "decrypt", SIZE_MAX,
+                                     [encrypt](size_t size) {
+                                         return encrypt(RandomBytes(size));
+                                     },
+                                     decrypt});
+                }
+            }
+        }
+    }
+
+    void AddRsaCases(std::vector<Case> &cases) {
+        using RSA = Algorithm::Advance::RSA;
+        const std::vector<RSA::KeySize> keySizes = {RSA::KeySize::KS_1024,
+                                                    RSA::KeySize::KS_2048,
+                                                    RSA::KeySize::KS_4096};
+        const std::vector<RSA::PaddingScheme> paddings = {
+                RSA::PaddingScheme::PKCS1v15, RSA::PaddingScheme::OAEP_SHA1,
+                RSA::PaddingScheme::OAEP_SHA256,
+                RSA::PaddingScheme::OAEP_SHA512};
+
+        for (const auto keySize : keySizes) {
+            const std::string bits =
+                    std::to_string(static_cast<unsigned>(keySize));
+            cases.push_back({"cipher", "rsa-" + bits, "generate", SIZE_MAX,
+                             [](size_t) {
+                                 return std::string();
+                             },
+                             [keySize](const std::string &) {
+                                 auto [pub, priv] = RSA::GenerateKeyPair(
+                                         keySize, RSA::PEMFormatType::PKCS);
+                                 if (!pub.success)
+                                     throw std::runtime_error(pub.error);
+                                 return priv.data;
+                             },
+                             {0}});
+
+            // Key pairs are generated lazily, only if a case is selected
+            auto keys = std::make_shared<std::pair<std::string, std::string>>();
+            auto ensureKeys = [keys, keySize] {
+                if (keys->first.empty()) {
+                    auto [pub, priv] = RSA::GenerateKeyPair(
+                            keySize, RSA::PEMFormatType::PKCS);
+                    keys->first = pub.data;
+                    keys->second = priv.data;
+                }
+            };
+
+            const size_t modulusBytes = static_cast<unsigned>(keySize) / 8;
+            for (const auto padding : paddings) {
+                size_t overhead = 11; // PKCS #1 v1.5
+                if (padding == RSA::PaddingScheme::OAEP_SHA1)
+                    overhead = 2 * 20 + 2;
+                else if (padding == RSA::PaddingScheme::OAEP_SHA256)
+                    overhead = 2 * 32 + 2;
+                else if (padding == RSA::PaddingScheme::OAEP_SHA512)
+                    overhead = 2 * 64 + 2;
+                if (overhead >= modulusBytes)
+                    continue;
+                const size_t capacity = modulusBytes - overhead;
+                std::vector<size_t> sizes = {std::min<size_t>(16, capacity),
+                                             capacity};
+                const std::string name = "rsa-" + bits + "-" +
+                        RSA::PaddingSchemeToString(padding);
+
+                auto encrypt = [=](const std::string &data) {
+                    ensureKeys();
+                    auto result = RSA::Encrypt(data, keys->first,
+                                               RSA::PEMFormatType::PKCS,
+                                               padding);
+                    if (!result.success)
+                        throw std::runtime_error(result.error);
+                    return result.data;
+                };
+                auto decrypt = [=](const std::string &data) {
+                    ensureKeys();
+                    auto result = RSA::Decrypt(data, keys->second,
+                                               RSA::PEMFormatType::PKCS,
+                                               padding);
+                    if (!result.success)
+                        throw std::runtime_error(result.error);
+                    return result.data;
+                };
+                cases.push_back({"cipher", name, "encrypt", SIZE_MAX,
+                                 [](size_t size) {
+                                     return RandomBytes(size);
+                                 },
+                                 encrypt, sizes});
+                cases.push_back({"cipher", name, "decrypt", SIZE_MAX,
+                                 [encrypt](size_t size) {
+                                     return encrypt(RandomBytes(size));
+                                 },
+                                 decrypt, sizes});
+            }
+        }
+    }
+
+    bool Selected(const Options &options, const Case &benchCase) {
+        if (options.filters.empty())
+            return true;
+        const std::string id = benchCase.group + "/" + benchCase.name + "/" +
+                benchCase.operation;
+        return std::ranges::any_of(options.filters,
+                                   [&id](const std::string &filter) {
+                                       return id.find(filter) !=
+                                               std::string::npos;
+                                   });
+    }
+
+    void PrintUsage() {
+        std::cerr
+                << "Usage: CryptoToysPP_bench [options]\n"
+                   "  --min-size <n>        Smallest input size (default 16)\n"
+                   "  --max-size <n>        Largest input size, e.g. 1G "
+                   "(default 64M)\n"
+                   "  --quadratic-max <n>   Size cap for Base58/Base62 "
+                   "(default 16K)\n"
+                   "  --min-time <sec>      Sampling time per case (default "
+                   "0.2)\n"
+                   "  --max-iterations <n>  Iteration cap per case (default "
+                   "10000)\n"
+                   "  --filter <text>       Only run cases whose "
+                   "group/name/operation contains text (repeatable)\n"
+                   "  --output <file>       Write JSON report to file "
+                   "(default stdout)\n"
+                   "  --list                List case identifiers and exit\n"
+                   "  --quiet               Do not print progress to stderr\n";
+    }
+
+    int Run(int argc, char **argv) {
+        Options options;
+        bool listOnly = false;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--min-size") {
+                options.minSize = std::max<size_t>(1, ParseSize(next()));
+            } else if (arg == "--max-size") {
+                options.maxSize = ParseSize(next());
+            } else if (arg == "--quadratic-max") {
+                options.quadraticMaxSize = ParseSize(next());
+            } else if (arg == "--min-time") {
+                options.minSeconds = std::stod(next());
+            } else if (arg == "--max-iterations") {
+                options.maxIterations = std::max<size_t>(1, ParseSize(next()));
+                options.minIterations =
+                        std::min(options.minIterations, options.maxIterations);
+            } else if (arg == "--filter") {
+                options.filters.push_back(next());
+            } else if (arg == "--output") {
+                options.outputPath = next();
+            } else if (arg == "--list") {
+                listOnly = true;
+            } else if (arg == "--quiet") {
+                options.quiet = true;
+            } else {
+                PrintUsage();
+                return arg == "--help" || arg == "-h" ? 0 : 1;
+            }
+        }
+
+        // Keep algorithm logging out of the measurements
+        spdlog::set_level(spdlog::level::err);
+
+        std::vector<Case> cases;
+        AddCodecCases(cases, options);
+        AddHashCases(cases);
+        AddAesCases(cases);
+        AddRsaCases(cases);
+
+        if (listOnly) {
+            for (const auto &benchCase : cases) {
+                if (Selected(options, benchCase))
+                    std::cout << benchCase.group << "/" << benchCase.name
+                              << "/" << benchCase.operation << "\n";
+            }
+            return 0;
+        }
+
+        nlohmann::json results = nlohmann::json::array();
+        for (const auto &benchCase : cases) {
+            if (!Selected(options, benchCase))
+                continue;
+            const std::vector<size_t> sizes = benchCase.fixedSizes.empty()
+                    ? SizeSweep(options, benchCase.maxSize)
+                    : benchCase.fixedSizes;
+            for (const size_t size : sizes) {
+                try {
+                    auto result = Measure(options, benchCase, size);
+                    if (!options.quiet) {
+                        std::cerr << benchCase.group << "/" << benchCase.name
+                                  << "/" << benchCase.operation << " ["
+                                  << FormatSize(size) << "] "
+                                  << result["mb_per_s"].get<double>()
+                                  << " MB/s, p50 "
+                                  << result["latency_ns"]["p50"].get<double>()
+                                  << " ns\n";
+                    }
+                    results.push_back(std::move(result));
+                } catch (const std::exception &e) {
+                    if (!options.quiet) {
+                        std::cerr << benchCase.group << "/" << benchCase.name
+                                  << "/" << benchCase.operation << " ["
+                                  << FormatSize(size)
+                                  << "] failed: " << e.what() << "\n";
+                    }
+                    results.push_back({{"group", benchCase.group},
+                                       {"name", benchCase.name},
+                                       {"operation", benchCase.operation},
+                                       {"input_bytes", size},
+                                       {"error", e.what()}});
+                }
+            }
+        }
+
+        const nlohmann::json report = {
+                {"schema", "cryptotoyspp-bench/1"},
+                {"timestamp",
+                 std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count()},
+                {"environment",
+                 {{"hardware_threads", std::thread::hardware_concurrency()},
+                  {"cycle_counter", BENCH_HAS_TSC ? "tsc" : "none"},
+                  {"simd",
+                   Algorithm::Common::SimdLevelToString(
+                           Algorithm::Common::GetSimdLevel())},
+#ifdef NDEBUG
+                  {"build_type", "release"},
+#else
+                  {"build_type", "debug"},
+#endif
+                  {"min_seconds", options.minSeconds},
+                  {"max_iterations", options.maxIterations}}},
+                {"results", results}};
+
+        if (options.outputPath.empty()) {
+            std::cout << report.dump(2) << std::endl;
+        } else {
+            std::ofstream out(options.outputPath);
+            if (!out) {
+                std::cerr << "Cannot open output file: " << options.outputPath
+                          << "\n";
+                return 1;
+            }
+            out << report.dump(2) << std::endl;
+        }
+        return 0;
+    }
+} // namespace CryptoToysPP::Bench
+
+int main(int argc, char **argv) {
+    try {
+        return CryptoToysPP::Bench::Run(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return 1;
+    }
+}
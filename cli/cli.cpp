@@ -0,0 +1,926 @@
+/* clang-format off */
+/*
+ * @file cli.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "algorithm/base/base16.h"
+#include "algorithm/base/base32.h"
+#include "algorithm/base/base58.h"
+#include "algorithm/base/base62.h"
+#include "algorithm/base/base64.h"
+#include "algorithm/base/base85.h"
+#include "algorithm/base/base91.h"
+#include "algorithm/base/base92.h"
+#include "algorithm/base/base100.h"
+#include "algorithm/simple/uucode.h"
+#include "algorithm/simple/xxcode.h"
+#include "algorithm/simple/vigenere.h"
+#include "algorithm/simple/section.h"
+#include "algorithm/hash/hasher.h"
+#include "algorithm/hash/file_hash.h"
+#include "algorithm/hash/tree_hash.h"
+#include "algorithm/hash/hmac.h"
+#include "algorithm/advance/aes.h"
+#include "algorithm/advance/rsa.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/file_source.h"
+#include "algorithm/common/hex.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <spdlog/spdlog.h>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace CryptoToysPP::Cli {
+    using Transform = std::function<std::string(const std::string &)>;
+
+    // Command line configuration
+    struct Options {
+        std::string algorithm;
+        std::string operation;
+        std::vector<std::string> inputs; // Empty or "-" means stdin
+        std::string outputPath;          // Empty or "-" means stdout
+        size_t chunkSize = size_t{64} << 10;
+        size_t maxBuffer = size_t{64} << 20; // Cap for whole-input codecs
+        bool keepWhitespace = false;
+        bool stats = false; // Report hashing throughput on stderr
+        std::string leavesPath; // Leaf hashes of the tree operation
+
+        // Cipher parameters
+        std::string key;
+        std::string iv;
+        std::string keyFile;
+        std::string mode = "CBC";
+        std::string padding;
+        std::string encoding = "NONE";
+        std::string format = "PKCS";
+        int bits = 0; // 0 selects 256 for AES and 2048 for RSA
+    };
+
+    // Sequential reader over several inputs, as if they were concatenated
+    class InputChain {
+    public:
+        explicit InputChain(const std::vector<std::string> &paths)
+            : paths(paths.empty() ? std::vector<std::string>{"-"} : paths) {
+        }
+
+        // Fill up to size bytes; returns 0 once every input is exhausted
+        size_t Read(char *buffer, size_t size) {
+            size_t total = 0;
+            while (total < size) {
+                std::istream *in = Current();
+                if (in == nullptr)
+                    break;
+                in->read(buffer + total,
+                         static_cast<std::streamsize>(size - total));
+                const auto got = static_cast<size_t>(in->gcount());
+                total += got;
+                if (got == 0 || !*in) {
+                    file.reset();
+                    ++index;
+                }
+            }
+            return total;
+        }
+
+    private:
+        std::istream *Current() {
+            if (index >= paths.size())
+                return nullptr;
+            if (paths[index] == "-")
+                return &std::cin;
+            if (!file) {
+                file = std::make_unique<std::ifstream>(paths[index],
+                                                       std::ios::binary);
+                if (!*file)
+                    throw std::runtime_error("Cannot open input file: " +
+                                             paths[index]);
+            }
+            return file.get();
+        }
+
+        std::vector<std::string> paths;
+        size_t index = 0;
+        std::unique_ptr<std::ifstream> file;
+    };
+
+    // Chunked codec driver: the transform is applied to whole blocks of
+    // blockSize input bytes, carrying any remainder into the next chunk, so
+    // the concatenated outputs equal the output of a single call.
+    struct BlockCodec {
+        size_t blockSize; // 0 means the whole input must be buffered
+        Transform transform;
+        bool ignoreWhitespace; // Strip ASCII whitespace before decoding
+
+        // Codecs with stream objects take every chunk as it arrives
+        // instead; std::nullopt reports malformed input
+        std::function<std::optional<std::string>(const std::string &)> update;
+        std::function<std::optional<std::string>()> finish;
+    };
+
+    void StripWhitespace(std::string &data) {
+        std::erase_if(data, [](const char c) {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        });
+    }
+
+    void RunCodec(const Options &options,
+                  const BlockCodec &codec,
+                  std::ostream &output) {
+        InputChain input(options.inputs);
+        std::string chunk(options.chunkSize, '\0');
+        std::string pending;
+        bool producedInput = false;
+
+        auto emit = [&](const std::string &data) {
+            if (data.empty())
+                return;
+            const std::string out = codec.transform(data);
+            if (out.empty())
+                throw std::runtime_error("Invalid input for " +
+                                         options.algorithm + " " +
+                                         options.operation);
+            output.write(out.data(), static_cast<std::streamsize>(out.size()));
+        };
+
+        auto write = [&](const std::optional<std::string> &out) {
+            if (!out)
+                throw std::runtime_error("Invalid input for " +
+                                         options.algorithm + " " +
+                                         options.operation);
+            output.write(out->data(),
+                         static_cast<std::streamsize>(out->size()));
+        };
+
+        while (const size_t got = input.Read(chunk.data(), chunk.size())) {
+            producedInput = true;
+            std::string data = chunk.substr(0, got);
+            if (codec.ignoreWhitespace)
+                StripWhitespace(data);
+            if (codec.update) {
+                write(codec.update(data));
+                continue;
+            }
+            pending += data;
+            if (pending.empty())
+                continue;
+
+            if (codec.blockSize == 0) {
+                if (pending.size() > options.maxBuffer)
+                    throw std::runtime_error(
+                            options.algorithm +
+                            " needs the whole input in memory and it "
+                            "exceeds --max-buffer");
+                continue;
+            }
+
+            // Keep at least one partial block back: the final block may
+            // carry padding and must go through the transform last
+            const size_t ready = (pending.size() - 1) / codec.blockSize *
+                    codec.blockSize;
+            if (ready > 0) {
+                emit(pending.substr(0, ready));
+                pending.erase(0, ready);
+            }
+        }
+
+        if (!producedInput)
+            return;
+        if (codec.finish)
+            write(codec.finish());
+        else
+            emit(pending);
+    }
+
+    std::optional<std::string> ToText(const std::vector<uint8_t> &bytes) {
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    std::optional<std::string>
+    ToText(const std::optional<std::vector<uint8_t>> &bytes) {
+        if (!bytes)
+            return std::nullopt;
+        return ToText(*bytes);
+    }
+
+    // Drive one of the codecs' StreamEncoder/StreamDecoder objects
+    template<typename Stream>
+    BlockCodec StreamCodec(Stream stream, bool ignoreWhitespace) {
+        auto state = std::make_shared<Stream>(std::move(stream));
+        BlockCodec codec{1, nullptr, ignoreWhitespace};
+        codec.update = [state](const std::string &data) {
+            return ToText(state->Update(Algorithm::Common::AsBytes(data)));
+        };
+        codec.finish = [state] { return ToText(state->Finish()); };
+        return codec;
+    }
+
+    template<typename Encoder, typename Decoder, typename... Args>
+    BlockCodec StreamCodecFor(bool encode, bool strip, Args... args) {
+        if (encode)
+            return StreamCodec(Encoder(args...), false);
+        return StreamCodec(Decoder(args...), strip);
+    }
+
+    std::optional<BlockCodec> SelectStreamCodec(const Options &options,
+                                                bool encode,
+                                                bool strip) {
+        using namespace Algorithm::Base;
+        const std::string &name = options.algorithm;
+        if (name == "base16")
+            return StreamCodecFor<Base16::StreamEncoder,
+                                  Base16::StreamDecoder>(encode, strip);
+        if (name == "base32" || name == "base32hex" ||
+            name == "crockford32" || name == "zbase32") {
+            auto alphabet = Base32::Alphabet::RFC4648;
+            if (name == "base32hex")
+                alphabet = Base32::Alphabet::HEX;
+            else if (name == "crockford32")
+                alphabet = Base32::Alphabet::CROCKFORD;
+            else if (name == "zbase32")
+                alphabet = Base32::Alphabet::ZBASE32;
+            return StreamCodecFor<Base32::StreamEncoder,
+                                  Base32::StreamDecoder>(encode, strip,
+                                                         alphabet);
+        }
+        if (name == "base64" || name == "base64url") {
+            const auto variant = name == "base64url"
+                    ? Base64::Variant::URL
+                    : Base64::Variant::STANDARD;
+            return StreamCodecFor<Base64::StreamEncoder,
+                                  Base64::StreamDecoder>(encode, strip,
+                                                         variant);
+        }
+        if (name == "base85" || name == "z85" || name == "ascii85") {
+            auto variant = Base85::Variant::BASE85;
+            if (name == "z85")
+                variant = Base85::Variant::Z85;
+            else if (name == "ascii85")
+                variant = Base85::Variant::ASCII85;
+            return StreamCodecFor<Base85::StreamEncoder,
+                                  Base85::StreamDecoder>(encode, strip,
+                                                         variant);
+        }
+        if (name == "base91")
+            return StreamCodecFor<Base91::StreamEncoder,
+                                  Base91::StreamDecoder>(encode, strip);
+        if (name == "base92")
+            return StreamCodecFor<Base92::StreamEncoder,
+                                  Base92::StreamDecoder>(encode, strip);
+        if (name == "base100")
+            return StreamCodecFor<Base100::StreamEncoder,
+                                  Base100::StreamDecoder>(encode, strip);
+        return std::nullopt;
+    }
+
+    // Vigenere keeps its key position across chunks by rotating the key
+    // by the number of letters already processed
+    BlockCodec VigenereCodec(const Options &options, bool encode) {
+        if (options.key.empty())
+            throw std::invalid_argument("vigenere requires --key");
+        auto letters = std::make_shared<size_t>(0);
+        const std::string key = options.key;
+        return {1,
+                [key, letters, encode](const std::string &data) {
+                    const size_t shift = *letters % key.size();
+                    const std::string rotated =
+                            key.substr(shift) + key.substr(0, shift);
+                    *letters += std::ranges::count_if(data, [](const char c) {
+                        return std::isalpha(static_cast<unsigned char>(c)) !=
+                                0;
+                    });
+                    return encode ? Algorithm::Simple::Vigenere::Encode(
+                                            data, rotated)
+                                  : Algorithm::Simple::Vigenere::Decode(
+                                            data, rotated);
+                },
+                false};
+    }
+
+    BlockCodec SelectCodec(const Options &options) {
+        using namespace Algorithm::Base;
+        using namespace Algorithm::Simple;
+        const bool encode = options.operation == "encode";
+        if (!encode && options.operation != "decode")
+            throw std::invalid_argument("Codecs support encode or decode");
+        const bool strip = !encode && !options.keepWhitespace;
+
+        struct Entry {
+            size_t encodeBlock;
+            size_t decodeBlock;
+            std::string (*encode)(const std::string &);
+            std::string (*decode)(const std::string &);
+            bool lineBased;
+        };
+        // Codecs converting the input as one big number, and the
+        // line-based ones, are applied to the whole input
+        static const std::map<std::string, Entry> CODECS = {
+                {"base58", {0, 0, Base58::Encode, Base58::Decode, false}},
+                {"base62", {0, 0, Base62::Encode, Base62::Decode, false}},
+                {"uucode", {0, 0, UUCode::Encode, UUCode::Decode, true}},
+                {"xxcode", {0, 0, XXCode::Encode, XXCode::Decode, true}}};
+
+        if (options.algorithm == "vigenere")
+            return VigenereCodec(options, encode);
+        if (auto codec = SelectStreamCodec(options, encode, strip))
+            return *codec;
+
+        const auto it = CODECS.find(options.algorithm);
+        if (it == CODECS.end())
+            throw std::invalid_argument("Unknown algorithm: " +
+                                        options.algorithm);
+        const Entry &entry = it->second;
+        return {encode ? entry.encodeBlock : entry.decodeBlock,
+                encode ? Transform(entry.encode) : Transform(entry.decode),
+                strip && !entry.lineBased};
+    }
+
+    std::optional<Algorithm::Simple::SectionFormat>
+    SectionFormatFor(const Options &options) {
+        if (options.operation != "archive" && options.operation != "extract")
+            return std::nullopt;
+        if (options.algorithm == "uucode")
+            return Algorithm::Simple::SectionFormat::UU;
+        if (options.algorithm == "xxcode")
+            return Algorithm::Simple::SectionFormat::XX;
+        throw std::invalid_argument("Only uucode and xxcode support " +
+                                    options.operation);
+    }
+
+    // Each input becomes a "begin <mode> <name>" section named after the
+    // file, streamed a chunk at a time
+    void RunArchive(const Options &options,
+                    Algorithm::Simple::SectionFormat format,
+                    std::ostream &output) {
+        using Algorithm::Simple::SectionEncoder;
+        const std::vector<std::string> inputs = options.inputs.empty()
+                ? std::vector<std::string>{"-"}
+                : options.inputs;
+        SectionEncoder encoder(format);
+        std::string chunk(options.chunkSize, '\0');
+        auto write = [&](const auto &data) {
+            output.write(reinterpret_cast<const char *>(data.data()),
+                         static_cast<std::streamsize>(data.size()));
+        };
+
+        for (const auto &path : inputs) {
+            std::string name = "stdin";
+            uint32_t mode = 0644;
+            std::unique_ptr<std::ifstream> file;
+            std::istream *input = &std::cin;
+            if (path != "-") {
+                file = std::make_unique<std::ifstream>(path, std::ios::binary);
+                if (!*file)
+                    throw std::runtime_error("Cannot open input file: " +
+                                             path);
+                input = file.get();
+                name = std::filesystem::path(path).filename().string();
+                std::error_code error;
+                const auto status = std::filesystem::status(path, error);
+                if (!error)
+                    mode = static_cast<uint32_t>(status.permissions()) & 0777;
+            }
+
+            write(SectionEncoder::Begin(name, mode));
+            while (input->read(chunk.data(),
+                               static_cast<std::streamsize>(chunk.size())) ||
+                   input->gcount() > 0) {
+                write(encoder.Update(Algorithm::Common::AsBytes(
+                        std::string_view(chunk).substr(
+                                0, static_cast<size_t>(input->gcount())))));
+            }
+            write(encoder.Finish());
+        }
+    }
+
+    // Names come from the archive: only the last path component is used,
+    // so a section cannot write outside the target directory
+    std::filesystem::path SafeSectionPath(const std::filesystem::path &dir,
+                                          std::string_view name) {
+        const size_t slash = name.find_last_of("/\\");
+        if (slash != std::string_view::npos)
+            name.remove_prefix(slash + 1);
+        if (name.empty() || name == "." || name == "..")
+            throw std::runtime_error("Invalid file name in section");
+        return dir / std::filesystem::path(std::string(name));
+    }
+
+    // Every section found in the inputs is decoded straight to a file in
+    // the output directory; the written paths are listed on stdout
+    void RunExtract(const Options &options,
+                    Algorithm::Simple::SectionFormat format) {
+        using Algorithm::Simple::SectionDecoder;
+        const std::filesystem::path dir =
+                options.outputPath.empty() || options.outputPath == "-"
+                ? std::filesystem::path(".")
+                : std::filesystem::path(options.outputPath);
+        std::filesystem::create_directories(dir);
+
+        std::ofstream file;
+        std::filesystem::path current;
+        uint32_t currentMode = 0;
+        size_t sections = 0;
+        SectionDecoder decoder(
+                format,
+                {[&](std::string_view name, uint32_t mode) {
+                     current = SafeSectionPath(dir, name);
+                     currentMode = mode;
+                     file.open(current, std::ios::binary | std::ios::trunc);
+                     if (!file)
+                         throw std::runtime_error("Cannot open output file: " +
+                                                  current.string());
+                 },
+                 [&](std::span<const uint8_t> data) {
+                     file.write(reinterpret_cast<const char *>(data.data()),
+                                static_cast<std::streamsize>(data.size()));
+                 },
+                 [&] {
+                     file.close();
+                     if (!file)
+                         throw std::runtime_error("Failed to write " +
+                                                  current.string());
+                     std::error_code ignored;
+                     std::filesystem::permissions(
+                             current,
+                             static_cast<std::filesystem::perms>(currentMode &
+                                                                 0777),
+                             ignored);
+                     std::cout << current.string() << "\n";
+                     ++sections;
+                 }});
+
+        InputChain input(options.inputs);
+        std::string chunk(options.chunkSize, '\0');
+        while (const size_t got = input.Read(chunk.data(), chunk.size())) {
+            if (!decoder.Update(std::string_view(chunk.data(), got)))
+                throw std::runtime_error("Invalid input for " +
+                                         options.algorithm + " extract");
+        }
+        if (!decoder.Finish())
+            throw std::runtime_error("Truncated or invalid " +
+                                     options.algorithm + " section: " +
+                                     current.string());
+        if (sections == 0)
+            throw std::runtime_error("No " + options.algorithm +
+                                     " sections found");
+    }
+
+    // Merkle root per input; --leaves also writes the leaf hashes, one per
+    // line, so a range can be checked later without rehashing the rest
+    void RunTreeHash(const Options &options,
+                     const std::vector<Algorithm::Hash::Hasher::Type> &types,
+                     std::ostream &output) {
+        using TreeHash = Algorithm::Hash::TreeHash;
+        if (types.size() != 1)
+            throw std::invalid_argument("tree takes a single hash algorithm");
+        const std::vector<std::string> inputs = options.inputs.empty()
+                ? std::vector<std::string>{"-"}
+                : options.inputs;
+        if (!options.leavesPath.empty() && inputs.size() != 1)
+            throw std::invalid_argument("--leaves takes a single input");
+
+        for (const auto &path : inputs) {
+            const TreeHash::Result result =
+                    TreeHash::HashFile(types.front(), path);
+            output << Algorithm::Common::HexEncode(
+                              result.root, Algorithm::Common::HexCase::LOWER)
+                   << "  " << path << "\n";
+            if (options.leavesPath.empty())
+                continue;
+            std::ofstream leaves(options.leavesPath, std::ios::binary);
+            if (!leaves)
+                throw std::runtime_error("Cannot open leaves file: " +
+                                         options.leavesPath);
+            for (size_t i = 0; i < result.LeafCount(); ++i)
+                leaves << Algorithm::Common::HexEncode(
+                                  result.Leaf(i),
+                                  Algorithm::Common::HexCase::LOWER)
+                       << "\n";
+            if (!leaves.flush())
+                throw std::runtime_error("Failed to write leaves file: " +
+                                         options.leavesPath);
+        }
+    }
+
+    // One "<tag>  <name>" line per input, keyed with --key or --key-hex
+    void RunHmac(const Options &options,
+                 const std::vector<Algorithm::Hash::Hasher::Type> &types,
+                 std::ostream &output) {
+        if (types.size() != 1)
+            throw std::invalid_argument("hmac takes a single hash algorithm");
+        if (options.key.empty())
+            throw std::invalid_argument("hmac requires --key");
+        const std::vector<std::string> inputs = options.inputs.empty()
+                ? std::vector<std::string>{"-"}
+                : options.inputs;
+        Algorithm::Hash::Hmac hmac(types.front(), options.key);
+        for (const auto &path : inputs) {
+            Algorithm::Common::FileSource source(path);
+            while (true) {
+                const std::span<const uint8_t> block = source.Next();
+                if (block.empty())
+                    break;
+                hmac.Update(block);
+            }
+            output << hmac.FinalHex() << "  " << path << "\n";
+        }
+    }
+
+    bool RunHash(const Options &options, std::ostream &output) {
+        using Hasher = Algorithm::Hash::Hasher;
+        // "md5,sha256,..." computes several digests in a single pass
+        std::vector<Hasher::Type> types;
+        for (size_t start = 0; start <= options.algorithm.size();) {
+            size_t end = options.algorithm.find(',', start);
+            if (end == std::string::npos)
+                end = options.algorithm.size();
+            const Hasher::Type type = Hasher::StringToType(
+                    options.algorithm.substr(start, end - start));
+            if (type == Hasher::Type::UNKNOWN)
+                return false;
+            types.push_back(type);
+            start = end + 1;
+        }
+        if (options.operation == "tree") {
+            RunTreeHash(options, types, output);
+            return true;
+        }
+        if (options.operation == "hmac") {
+            RunHmac(options, types, output);
+            return true;
+        }
+        if (options.operation != "digest")
+            throw std::invalid_argument(
+                    "Hashes support the digest, tree and hmac operations");
+
+        // One digest line per input, in the familiar "<digest>  <name>"
+        // form, or "<ALGORITHM> (<name>) = <digest>" for several digests
+        const std::vector<std::string> inputs = options.inputs.empty()
+                ? std::vector<std::string>{"-"}
+                : options.inputs;
+        for (const auto &path : inputs) {
+            const Algorithm::Hash::FileDigests result =
+                    Algorithm::Hash::HashFile(path, types);
+            const std::vector<std::string> &digests = result.digests;
+            if (options.stats)
+                std::cerr << path << ": " << result.bytes << " bytes in "
+                          << result.seconds << " s ("
+                          << result.bytesPerSecond / (1024 * 1024)
+                          << " MiB/s" << (result.mapped ? ", mapped" : "")
+                          << ")\n";
+            if (types.size() == 1) {
+                output << digests.front() << "  " << path << "\n";
+                continue;
+            }
+            for (size_t i = 0; i < types.size(); ++i) {
+                std::string name = Hasher::TypeToString(types[i]);
+                std::ranges::transform(name, name.begin(), ::toupper);
+                output << name << " (" << path << ") = " << digests[i]
+                       << "\n";
+            }
+        }
+        return true;
+    }
+
+    void RunAes(const Options &options, std::ostream &output) {
+        using AES = Algorithm::Advance::AES;
+        if (options.inputs.size() > 1)
+            throw std::invalid_argument("aes accepts a single input");
+
+        std::string mode = options.mode;
+        std::string padding = options.padding;
+        std::string encoding = options.encoding;
+        std::ranges::transform(mode, mode.begin(), ::toupper);
+        std::ranges::transform(padding, padding.begin(), ::toupper);
+        std::ranges::transform(encoding, encoding.begin(), ::toupper);
+
+        const auto aesMode = AES::StringToAESMode(mode);
+        if (aesMode == AES::AESMode::UNKNOWN)
+            throw std::invalid_argument("Unknown AES mode: " + options.mode);
+        if (padding.empty())
+            padding = (aesMode == AES::AESMode::ECB ||
+                       aesMode == AES::AESMode::CBC)
+                    ? "PKCS7"
+                    : "NONE";
+        const auto aesPadding = AES::StringToPaddingScheme(padding);
+        if (aesPadding == AES::PaddingScheme::UNKNOWN)
+            throw std::invalid_argument("Unknown padding: " + options.padding);
+        const auto keyBits = AES::IntToKeyBits(options.bits ? options.bits
+                                                            : 256);
+        if (keyBits == AES::KeyBits::BITS_UNKNOWN)
+            throw std::invalid_argument("Key size must be 128, 192 or 256");
+        const auto aesEncoding = AES::StringToEncodingFormat(encoding);
+        if (aesEncoding == AES::EncodingFormat::UNKNOWN)
+            throw std::invalid_argument("Unknown encoding: " +
+                                        options.encoding);
+
+        std::unique_ptr<std::ifstream> file;
+        std::istream *input = &std::cin;
+        if (!options.inputs.empty() && options.inputs.front() != "-") {
+            file = std::make_unique<std::ifstream>(options.inputs.front(),
+                                                   std::ios::binary);
+            if (!*file)
+                throw std::runtime_error("Cannot open input file: " +
+                                         options.inputs.front());
+            input = file.get();
+        }
+
+        AES::Result result;
+        if (options.operation == "encrypt") {
+            result = AES::Encrypt(*input, output, aesMode, aesPadding, keyBits,
+                                  options.key, options.iv, aesEncoding);
+        } else if (options.operation == "decrypt") {
+            result = AES::Decrypt(*input, output, aesMode, aesPadding, keyBits,
+                                  options.key, options.iv, aesEncoding);
+        } else {
+            throw std::invalid_argument("aes supports encrypt or decrypt");
+        }
+        if (!result.success)
+            throw std::runtime_error(result.error);
+    }
+
+    std::string ReadTextFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("Cannot open file: " + path);
+        return {std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>()};
+    }
+
+    void RunRsa(const Options &options, std::ostream &output) {
+        using RSA = Algorithm::Advance::RSA;
+        const auto format = RSA::StringToPEMFormatType(options.format);
+        if (format == RSA::PEMFormatType::UNKNOWN)
+            throw std::invalid_argument("Unknown PEM format: " +
+                                        options.format);
+
+        if (options.operation == "generate") {
+            auto [publicKey, privateKey] = RSA::GenerateKeyPair(
+                    RSA::IntToKeySize(options.bits ? options.bits : 2048),
+                    format);
+            if (!publicKey.success)
+                throw std::runtime_error(publicKey.error);
+            if (!privateKey.success)
+                throw std::runtime_error(privateKey.error);
+            output << publicKey.data << privateKey.data;
+            return;
+        }
+
+        if (options.keyFile.empty())
+            throw std::invalid_argument("rsa requires --key-file");
+        const std::string key = ReadTextFile(options.keyFile);
+        const auto padding = RSA::StringToPaddingScheme(
+                options.padding.empty() ? "OAEP_SHA256" : options.padding);
+        if (padding == RSA::PaddingScheme::UNKNOWN)
+            throw std::invalid_argument("Unknown padding: " + options.padding);
+
+        // RSA works on a single modulus-sized block, so the input is small
+        InputChain input(options.inputs);
+        std::string data;
+        std::string chunk(options.chunkSize, '\0');
+        while (const size_t got = input.Read(chunk.data(), chunk.size())) {
+            data.append(chunk, 0, got);
+            if (data.size() > options.maxBuffer)
+                throw std::runtime_error("rsa input exceeds --max-buffer");
+        }
+
+        RSA::Result result;
+        if (options.operation == "encrypt") {
+            result = RSA::Encrypt(data, key, format, padding);
+        } else if (options.operation == "decrypt") {
+            result = RSA::Decrypt(data, key, format, padding);
+        } else {
+            throw std::invalid_argument(
+                    "rsa supports generate, encrypt or decrypt");
+        }
+        if (!result.success)
+            throw std::runtime_error(result.error);
+        output << result.data;
+    }
+
+    size_t ParseSize(const std::string &text) {
+        size_t pos = 0;
+        const unsigned long long value = std::stoull(text, &pos);
+        size_t shift = 0;
+        if (pos < text.size()) {
+            switch (std::toupper(static_cast<unsigned char>(text[pos]))) {
+                case 'K':
+                    shift = 10;
+                    break;
+                case 'M':
+                    shift = 20;
+                    break;
+                case 'G':
+                    shift = 30;
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid size: " + text);
+            }
+        }
+        return static_cast<size_t>(value) << shift;
+    }
+
+    void PrintUsage() {
+        std::cerr
+                << "Usage: CryptoToysPP_cli <algorithm> <operation> "
+                   "[options] [file ...]\n"
+                   "\n"
+                   "Algorithms and operations:\n"
+                   "  base16 base32 base32hex crockford32 zbase32 base58\n"
+                   "  base62 base64 base64url base85 z85 ascii85 base91\n"
+                   "  base92 base100 uucode xxcode vigenere\n"
+                   "                         encode | decode\n"
+                   "  uucode xxcode          archive | extract (files in "
+                   "begin/end sections;\n"
+                   "                         extract writes into the -o "
+                   "directory)\n"
+                   "  md2 md4 md5 sha1 sha224 sha256 sha384 sha512\n"
+                   "  sha3-224 sha3-256 sha3-384 sha3-512\n"
+                   "                         digest (join names with ',' "
+                   "for several in one pass)\n"
+                   "                         tree (Merkle root over 1 MiB "
+                   "leaves, RFC 6962)\n"
+                   "                         hmac (keyed with --key or "
+                   "--key-hex)\n"
+                   "  aes                    encrypt | decrypt\n"
+                   "  rsa                    generate | encrypt | decrypt\n"
+                   "\n"
+                   "Options:\n"
+                   "  -o, --output <file>    Output file (default stdout)\n"
+                   "  --chunk-size <n>       Read size per chunk (default "
+                   "64K)\n"
+                   "  --max-buffer <n>       Limit for codecs that need the "
+                   "whole input (default 64M)\n"
+                   "  --keep-whitespace      Do not strip whitespace before "
+                   "decoding\n"
+                   "  --stats                Report bytes/sec of each digest "
+                   "input on stderr\n"
+                   "  --leaves <file>        Write the leaf hashes of tree, "
+                   "one per line\n"
+                   "  --key <text>           AES, Vigenere or HMAC key\n"
+                   "  --key-hex <hex>        AES or HMAC key as hex\n"
+                   "  --iv <text>            AES IV\n"
+                   "  --iv-hex <hex>         AES IV as hex\n"
+                   "  --mode <mode>          AES mode (default CBC)\n"
+                   "  --padding <name>       AES or RSA padding scheme\n"
+                   "  --encoding <name>      AES ciphertext encoding: NONE, "
+                   "BASE64, HEX\n"
+                   "  --bits <n>             AES key bits or RSA key size\n"
+                   "  --key-file <file>      RSA PEM key\n"
+                   "  --format <name>        RSA PEM format: PKCS, RSA\n";
+    }
+
+    int Run(int argc, char **argv) {
+        Options options;
+        std::vector<std::string> positional;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            auto fromHex = [&](const std::string &hex) {
+                std::string raw = Algorithm::Advance::AES::HexToString(hex);
+                if (raw.empty())
+                    throw std::invalid_argument("Invalid hex for " + arg);
+                return raw;
+            };
+            if (arg == "-h" || arg == "--help") {
+                PrintUsage();
+                return 0;
+            } else if (arg == "-o" || arg == "--output") {
+                options.outputPath = next();
+            } else if (arg == "--chunk-size") {
+                options.chunkSize = std::max<size_t>(1, ParseSize(next()));
+            } else if (arg == "--max-buffer") {
+                options.maxBuffer = ParseSize(next());
+            } else if (arg == "--keep-whitespace") {
+                options.keepWhitespace = true;
+            } else if (arg == "--stats") {
+                options.stats = true;
+            } else if (arg == "--leaves") {
+                options.leavesPath = next();
+            } else if (arg == "--key") {
+                options.key = next();
+            } else if (arg == "--key-hex") {
+                options.key = fromHex(next());
+            } else if (arg == "--iv") {
+                options.iv = next();
+            } else if (arg == "--iv-hex") {
+                options.iv = fromHex(next());
+            } else if (arg == "--mode") {
+                options.mode = next();
+            } else if (arg == "--padding") {
+                options.padding = next();
+            } else if (arg == "--encoding") {
+                options.encoding = next();
+            } else if (arg == "--bits") {
+                options.bits = std::stoi(next());
+            } else if (arg == "--key-file") {
+                options.keyFile = next();
+            } else if (arg == "--format") {
+                options.format = next();
+            } else if (arg.size() > 1 && arg[0] == '-' && arg != "-") {
+                throw std::invalid_argument("Unknown option: " + arg);
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        if (positional.size() < 2) {
+            PrintUsage();
+            return 1;
+        }
+        options.algorithm = positional[0];
+        options.operation = positional[1];
+        options.inputs.assign(positional.begin() + 2, positional.end());
+        std::ranges::transform(options.algorithm, options.algorithm.begin(),
+                               ::tolower);
+
+        // Diagnostics go to stderr; keep library logging quiet by default
+        spdlog::set_level(spdlog::level::err);
+
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        std::ios::sync_with_stdio(false);
+
+        // Extraction treats -o as a directory and writes one file per
+        // section
+        const auto sectionFormat = SectionFormatFor(options);
+        if (sectionFormat && options.operation == "extract") {
+            RunExtract(options, *sectionFormat);
+            return 0;
+        }
+
+        std::unique_ptr<std::ofstream> file;
+        std::ostream *output = &std::cout;
+        if (!options.outputPath.empty() && options.outputPath != "-") {
+            file = std::make_unique<std::ofstream>(options.outputPath,
+                                                   std::ios::binary);
+            if (!*file)
+                throw std::runtime_error("Cannot open output file: " +
+                                         options.outputPath);
+            output = file.get();
+        }
+
+        if (sectionFormat) {
+            RunArchive(options, *sectionFormat, *output);
+        } else if (options.algorithm == "aes") {
+            RunAes(options, *output);
+        } else if (options.algorithm == "rsa") {
+            RunRsa(options, *output);
+        } else if (!RunHash(options, *output)) {
+            RunCodec(options, SelectCodec(options), *output);
+        }
+
+        output->flush();
+        if (!*output)
+            throw std::runtime_error("Failed to write output");
+        return 0;
+    }
+} // namespace CryptoToysPP::Cli
+
+int main(int argc, char **argv) {
+    try {
+        return CryptoToysPP::Cli::Run(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "CryptoToysPP_cli: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,205 @@
+/* clang-format off */
+/*
+ * @file kat.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "algorithm/hash/hasher.h"
+#include "algorithm/hash/batch_hash.h"
+#include "algorithm/common/cpu.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Known-answer check for the multi-lane MD5/SHA-1/SHA-256 batch kernels.
+// Fixed vectors pin the digests themselves; generated batches compare
+// every message against a scalar Hasher so that partial lane groups,
+// mixed lengths and padding edges (55/56/63/64 bytes) are all covered.
+// CRYPTOTOYSPP_SIMD selects the kernel under test; ctest runs one pass
+// per level. Exits non-zero on the first mismatching algorithm.
+
+namespace CryptoToysPP::Kat {
+    using Algorithm::Hash::Hasher;
+
+    struct Vector {
+        Hasher::Type type;
+        std::string message;
+        std::string_view digest;
+    };
+
+    const std::string ABC = "abc";
+    const std::string TWO_BLOCK =
+            "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const std::string MILLION_A(1000000, 'a');
+
+    // FIPS 180 / RFC 1321 test vectors
+    const std::vector<Vector> &Vectors() {
+        static const std::vector<Vector> vectors = {
+                {Hasher::Type::MD5, "", "d41d8cd98f00b204e9800998ecf8427e"},
+                {Hasher::Type::MD5, ABC, "900150983cd24fb0d6963f7d28e17f72"},
+                {Hasher::Type::MD5, TWO_BLOCK,
+                 "8215ef0796a20bcaaae116d3876c664a"},
+                {Hasher::Type::MD5, MILLION_A,
+                 "7707d6ae4e027c70eea2a935c2296f21"},
+                {Hasher::Type::SHA1, "",
+                 "da39a3ee5e6b4b0d3255bfef95601890afd80709"},
+                {Hasher::Type::SHA1, ABC,
+                 "a9993e364706816aba3e25717850c26c9cd0d89d"},
+                {Hasher::Type::SHA1, TWO_BLOCK,
+                 "84983e441c3bd26ebaae4aa1f95129e5e54670f1"},
+                {Hasher::Type::SHA1, MILLION_A,
+                 "34aa973cd4c4daa4f61eeb2bdbad27316534016f"},
+                {Hasher::Type::SHA256, "",
+                 "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852"
+                 "b855"},
+                {Hasher::Type::SHA256, ABC,
+                 "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f200"
+                 "15ad"},
+                {Hasher::Type::SHA256, TWO_BLOCK,
+                 "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db"
+                 "06c1"},
+                {Hasher::Type::SHA256, MILLION_A,
+                 "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc711"
+                 "2cd0"},
+        };
+        return vectors;
+    }
+
+    // Deterministic bytes so a failure reproduces on every run
+    std::string MakeMessage(size_t length, uint32_t seed) {
+        std::string message(length, '\0');
+        uint32_t state = seed * 2654435761u + 1;
+        for (char &c : message) {
+            state = state * 1664525u + 1013904223u;
+            c = static_cast<char>(state >> 24);
+        }
+        return message;
+    }
+
+    // Batches hashed in one call: every length up to a few blocks, every
+    // batch size up to two AVX-512 groups, and one batch large enough to
+    // be split across the executor
+    std::vector<std::vector<std::string>> MakeBatches() {
+        std::vector<std::vector<std::string>> batches;
+
+        std::vector<std::string> lengths;
+        for (size_t length = 0; length <= 300; ++length)
+            lengths.push_back(MakeMessage(length, 1));
+        batches.push_back(lengths);
+        std::reverse(lengths.begin(), lengths.end());
+        batches.push_back(std::move(lengths));
+
+        for (size_t count = 1; count <= 33; ++count) {
+            std::vector<std::string> batch;
+            for (size_t i = 0; i < count; ++i) {
+                const auto seed = static_cast<uint32_t>(count * 64 + i);
+                batch.push_back(MakeMessage(seed * 7919 % 257, seed));
+            }
+            batches.push_back(std::move(batch));
+        }
+
+        std::vector<std::string> large;
+        for (uint32_t i = 0; i < 10000; ++i)
+            large.push_back(MakeMessage(i * 31 % 200, i));
+        batches.push_back(std::move(large));
+        return batches;
+    }
+
+    // Returns the number of mismatching digests for `type`
+    size_t Check(Hasher::Type type,
+                 const std::vector<std::vector<std::string>> &batches) {
+        const std::string name = Hasher::TypeToString(type);
+        size_t failures = 0;
+
+        for (const Vector &vector : Vectors()) {
+            if (vector.type != type)
+                continue;
+            const std::string_view message = vector.message;
+            const auto digests = Algorithm::Hash::BatchHexDigest(
+                    type, std::span<const std::string_view>(&message, 1));
+            if (digests.front() != vector.digest) {
+                std::cerr << name << ": vector of " << message.size()
+                          << " bytes: got " << digests.front()
+                          << ", expected " << vector.digest << "\n";
+                ++failures;
+            }
+        }
+
+        Hasher scalar(type);
+        for (const auto &batch : batches) {
+            const std::vector<std::string_view> messages(batch.begin(),
+                                                         batch.end());
+            const auto digests =
+                    Algorithm::Hash::BatchHexDigest(type, messages);
+            for (size_t i = 0; i < messages.size(); ++i) {
+                const std::string expected =
+                        scalar.Update(messages[i]).FinalHex();
+                if (digests[i] != expected) {
+                    std::cerr << name << ": message " << i << " of "
+                              << messages.size() << " ("
+                              << messages[i].size() << " bytes): got "
+                              << digests[i] << ", expected " << expected
+                              << "\n";
+                    ++failures;
+                }
+            }
+        }
+        return failures;
+    }
+
+    int Run() {
+        const std::string level = Algorithm::Common::SimdLevelToString(
+                Algorithm::Common::GetSimdLevel());
+        const auto batches = MakeBatches();
+
+        int status = 0;
+        for (const Hasher::Type type : {Hasher::Type::MD5,
+                                        Hasher::Type::SHA1,
+                                        Hasher::Type::SHA256}) {
+            const size_t failures = Check(type, batches);
+            std::cout << Hasher::TypeToString(type) << " [" << level
+                      << (Algorithm::Hash::HasBatchKernel(type)
+                                  ? ", batch kernel"
+                                  : ", scalar fallback")
+                      << "]: " << (failures == 0 ? "ok" : "FAILED")
+                      << "\n";
+            if (failures != 0)
+                status = 1;
+        }
+        return status;
+    }
+} // namespace CryptoToysPP::Kat
+
+int main() {
+    try {
+        return CryptoToysPP::Kat::Run();
+    } catch (const std::exception &e) {
+        std::cerr << "Known-answer check failed: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -26,6 +26,9 @@
  */
 /* clang-format on */
 #include "aes.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/hex.h"
+#include "algorithm/common/lru_cache.h"
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
 #include <cryptopp/xts.h>
@@ -33,10 +36,15 @@
 #include <cryptopp/eax.h>
 #include <cryptopp/gcm.h>
 #include <cryptopp/filters.h>
+#include <cryptopp/files.h>
 #include <cryptopp/base64.h>
 #include <cryptopp/hex.h>
 #include <cryptopp/osrng.h>
+#include <cryptopp/sha.h>
 #include <spdlog/spdlog.h>
+#include <memory>
+#include <mutex>
+#include <optional>
 namespace CryptoToysPP::Algorithm::Advance {
     std::string AES::AESModeToString(AESMode mode) {
         switch (mode) {
@@ -151,62 +159,10 @@ namespace CryptoToysPP::Algorithm::Advance {
     }
 
     std::string AES::HexToString(const std::string &hex) {
-        // Validate input length
-        if (hex.empty() || hex.size() % 2 != 0)
+        // Empty, odd-length or non-hex input yields an empty string
+        if (hex.empty())
             return "";
-
-        // Pre-allocate result memory (avoid dynamic expansion)
-        std::string result;
-        result.resize(hex.size() / 2);
-
-        // 256-byte static lookup table (O(1) time complexity)
-        static constexpr uint8_t lookup[256] =
-                {// 0-47: Invalid characters (default 0xFF)
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 // 48-57: '0'-'9' → 0-9
-                 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-                 // 58-64: Invalid characters
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 // 65-70: 'A'-'F' → 10-15
-                 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
-                 // 71-96: Invalid characters
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 // 97-102: 'a'-'f' → 10-15
-                 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
-                 // Remainder are invalid
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-
-        // Core conversion logic
-        for (size_t i = 0; i < hex.size(); i += 2) {
-            const uint8_t hi_val = lookup[static_cast<uint8_t>(hex[i])];
-            const uint8_t lo_val = lookup[static_cast<uint8_t>(hex[i + 1])];
-
-            // Invalid character detection (0xFF indicates invalid)
-            if (hi_val == 0xFF || lo_val == 0xFF)
-                return "";
-
-            // Bitwise combination of high and low bits
-            result[i / 2] = static_cast<char>((hi_val << 4) | lo_val);
-        }
-        return result;
+        return Common::HexDecode(hex).value_or("");
     }
 
 
@@ -359,6 +315,10 @@ namespace CryptoToysPP::Algorithm::Advance {
             }
         } else if (encoding == EncodingFormat::HEX) {
             if (decode) {
+                // Well-formed hex takes the shared engine; anything else
+                // keeps HexDecoder's behaviour of skipping stray characters
+                if (auto decoded = Common::HexDecode(input))
+                    return *decoded;
                 std::string decoded;
                 CryptoPP::HexDecoder decoder;
                 decoder.Put(reinterpret_cast<const CryptoPP::byte *>(
@@ -370,21 +330,228 @@ namespace CryptoToysPP::Algorithm::Advance {
                             decoded.size());
                 return decoded;
             } else {
-                std::string encoded;
-                CryptoPP::HexEncoder encoder;
-                encoder.Put(reinterpret_cast<const CryptoPP::byte *>(
-                                    input.data()),
-                            input.size());
-                encoder.MessageEnd();
-                encoded.resize(encoder.MaxRetrievable());
-                encoder.Get(reinterpret_cast<CryptoPP::byte *>(encoded.data()),
-                            encoded.size());
-                return encoded;
+                return Common::HexEncode(Common::AsBytes(input));
             }
         }
         return input;
     }
 
+    // Keyed cipher object for one (mode, direction, key) combination. The
+    // Crypto++ objects keep their round keys (and GCM tables) in SecBlocks,
+    // which are wiped when the context is destroyed on eviction.
+    struct AES::CipherContext {
+        std::string cacheKey;
+        AESMode mode = AESMode::UNKNOWN;
+        bool encryption = true;
+        std::unique_ptr<CryptoPP::SymmetricCipher> cipher; // ECB..XTS
+        std::unique_ptr<CryptoPP::AuthenticatedSymmetricCipher> aead; // CCM..
+
+        CryptoPP::SimpleKeyingInterface &Keying() {
+            if (aead)
+                return *aead;
+            return *cipher;
+        }
+
+        // Build the filter that runs this cipher in front of sink
+        CryptoPP::BufferedTransformation *
+        CreateFilter(CryptoPP::BufferedTransformation *sink,
+                     CryptoPP::BlockPaddingSchemeDef::BlockPaddingScheme
+                             padding,
+                     size_t inputLength) {
+            switch (mode) {
+                case AESMode::ECB:
+                case AESMode::CBC:
+                    return new CryptoPP::StreamTransformationFilter(
+                            *cipher, sink, padding);
+                case AESMode::OFB:
+                case AESMode::CFB:
+                case AESMode::XTS:
+                    return new CryptoPP::StreamTransformationFilter(
+                            *cipher, sink,
+                            CryptoPP::BlockPaddingSchemeDef::NO_PADDING);
+                case AESMode::CCM: {
+                    if (encryption) {
+                        aead->SpecifyDataLengths(0, inputLength, 0);
+                        return new CryptoPP::AuthenticatedEncryptionFilter(
+                                *aead, sink,
+                                false, // Do not append authentication tag,
+                                       // (already included in CCM)
+                                CCM_TAG_SIZE);
+                    }
+                    if (inputLength < CCM_TAG_SIZE)
+                        throw std::invalid_argument(
+                                "Ciphertext shorter than CCM tag");
+                    aead->SpecifyDataLengths(0, inputLength - CCM_TAG_SIZE, 0);
+                    return new CryptoPP::AuthenticatedDecryptionFilter(
+                            *aead, sink,
+                            CryptoPP::AuthenticatedDecryptionFilter::
+                                    DEFAULT_FLAGS,
+                            CCM_TAG_SIZE);
+                }
+                case AESMode::EAX:
+                case AESMode::GCM:
+                    if (encryption)
+                        return new CryptoPP::AuthenticatedEncryptionFilter(
+                                *aead, sink);
+                    return new CryptoPP::AuthenticatedDecryptionFilter(*aead,
+                                                                       sink);
+                default:
+                    throw std::invalid_argument("Unsupported mode");
+            }
+        }
+    };
+
+    // Bounded LRU of idle cipher contexts, shared by all threads
+    struct AES::CipherCache {
+        std::mutex mutex;
+        Common::LruCache<std::string, std::unique_ptr<CipherContext>> entries{
+                CIPHER_CACHE_CAPACITY};
+    };
+
+    AES::CipherCache &AES::getCipherCache() {
+        static CipherCache cache;
+        return cache;
+    }
+
+    void AES::ClearCipherCache() {
+        auto &cache = getCipherCache();
+        std::lock_guard lock(cache.mutex);
+        cache.entries.Clear();
+    }
+
+    namespace {
+        // Allocate an encryption or decryption object and run the full key
+        // setup; only done on a cache miss
+        template<typename Base, typename Encryption, typename Decryption>
+        std::unique_ptr<Base> MakeCipher(bool encryption,
+                                         const CryptoPP::SecByteBlock &key,
+                                         const CryptoPP::SecByteBlock *iv) {
+            std::unique_ptr<Base> cipher;
+            if (encryption) {
+                cipher = std::make_unique<Encryption>();
+            } else {
+                cipher = std::make_unique<Decryption>();
+            }
+            if (iv != nullptr) {
+                cipher->SetKeyWithIV(key, key.size(), *iv, iv->size());
+            } else {
+                cipher->SetKey(key, key.size());
+            }
+            return cipher;
+        }
+    } // namespace
+
+    std::unique_ptr<AES::CipherContext>
+    AES::acquireCipher(AESMode mode,
+                       bool encryption,
+                       KeyBits keyBits,
+                       const CryptoPP::SecByteBlock &keyBlock,
+                       const CryptoPP::SecByteBlock &ivBlock) {
+        // Cache key: mode, direction, key bits and a digest of the key, so
+        // the raw key itself is never kept as a map key
+        std::string cacheKey;
+        cacheKey.push_back(static_cast<char>(mode));
+        cacheKey.push_back(encryption ? 'E' : 'D');
+        cacheKey.append(std::to_string(static_cast<int>(keyBits)));
+        cacheKey.push_back(':');
+        CryptoPP::SHA256 digest;
+        CryptoPP::byte keyDigest[CryptoPP::SHA256::DIGESTSIZE];
+        digest.CalculateDigest(keyDigest, keyBlock, keyBlock.size());
+        cacheKey.append(reinterpret_cast<const char *>(keyDigest),
+                        sizeof(keyDigest));
+
+        std::optional<std::unique_ptr<CipherContext>> cached;
+        {
+            auto &cache = getCipherCache();
+            std::lock_guard lock(cache.mutex);
+            cached = cache.entries.Take(cacheKey);
+        }
+        if (cached) {
+            // Reuse the expanded schedule; only the IV state is reset
+            auto context = std::move(*cached);
+            if (mode != AESMode::ECB)
+                context->Keying().Resynchronize(ivBlock, ivBlock.size());
+            return context;
+        }
+
+        auto context = std::make_unique<CipherContext>();
+        context->cacheKey = std::move(cacheKey);
+        context->mode = mode;
+        context->encryption = encryption;
+        using CryptoPP::AuthenticatedSymmetricCipher;
+        using CryptoPP::SymmetricCipher;
+        switch (mode) {
+            case AESMode::ECB:
+                context->cipher = MakeCipher<
+                        SymmetricCipher,
+                        CryptoPP::ECB_Mode<CryptoPP::AES>::Encryption,
+                        CryptoPP::ECB_Mode<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, nullptr);
+                break;
+            case AESMode::CBC:
+                context->cipher = MakeCipher<
+                        SymmetricCipher,
+                        CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption,
+                        CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::OFB:
+                context->cipher = MakeCipher<
+                        SymmetricCipher,
+                        CryptoPP::OFB_Mode<CryptoPP::AES>::Encryption,
+                        CryptoPP::OFB_Mode<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::CFB:
+                context->cipher = MakeCipher<
+                        SymmetricCipher,
+                        CryptoPP::CFB_Mode<CryptoPP::AES>::Encryption,
+                        CryptoPP::CFB_Mode<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::XTS:
+                context->cipher = MakeCipher<
+                        SymmetricCipher,
+                        CryptoPP::XTS_Mode<CryptoPP::AES>::Encryption,
+                        CryptoPP::XTS_Mode<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::CCM:
+                context->aead = MakeCipher<
+                        AuthenticatedSymmetricCipher,
+                        CryptoPP::CCM<CryptoPP::AES>::Encryption,
+                        CryptoPP::CCM<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::EAX:
+                context->aead = MakeCipher<
+                        AuthenticatedSymmetricCipher,
+                        CryptoPP::EAX<CryptoPP::AES>::Encryption,
+                        CryptoPP::EAX<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            case AESMode::GCM:
+                context->aead = MakeCipher<
+                        AuthenticatedSymmetricCipher,
+                        CryptoPP::GCM<CryptoPP::AES>::Encryption,
+                        CryptoPP::GCM<CryptoPP::AES>::Decryption>(
+                        encryption, keyBlock, &ivBlock);
+                break;
+            default:
+                return nullptr;
+        }
+        return context;
+    }
+
+    void AES::releaseCipher(std::unique_ptr<CipherContext> context) {
+        if (!context)
+            return;
+        auto &cache = getCipherCache();
+        std::lock_guard lock(cache.mutex);
+        const std::string key = context->cacheKey;
+        cache.entries.Put(key, std::move(context));
+    }
+
     AES::Result AES::Encrypt(const std::string &plaintext,
                              AESMode mode,
                              PaddingScheme padding,
@@ -417,122 +584,24 @@ namespace CryptoToysPP::Algorithm::Advance {
                 return result;
             }
 
-            auto cryptoPadding = getPaddingScheme(padding);
-            std::string ciphertext;
-
-            switch (mode) {
-                case AESMode::ECB: {
-                    CryptoPP::ECB_Mode<CryptoPP::AES>::Encryption
-                            encryptor(keyBlock, keyBlock.size());
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext),
-                                       cryptoPadding));
-                    break;
-                }
-                case AESMode::CBC: {
-                    CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption
-                            encryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext),
-                                       cryptoPadding));
-                    break;
-                }
-                case AESMode::OFB: {
-                    CryptoPP::OFB_Mode<CryptoPP::AES>::Encryption
-                            encryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::CFB: {
-                    CryptoPP::CFB_Mode<CryptoPP::AES>::Encryption
-                            encryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::XTS: {
-                    CryptoPP::XTS_Mode<CryptoPP::AES>::Encryption encryptor;
-                    encryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::CCM: {
-                    CryptoPP::CCM<CryptoPP::AES>::Encryption encryptor;
-                    encryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-
-                    // Correct usage of SpecifyDataLengths (3 parameters)
-                    encryptor.SpecifyDataLengths(0, plaintext.size(), 0);
-
-                    // Set tag length in AuthenticatedEncryptionFilter
-                    size_t tagSize =
-                            12; // Authentication tag length (configurable)
-                    CryptoPP::StringSource ss(
-                            plaintext, true,
-                            new CryptoPP::AuthenticatedEncryptionFilter(
-                                    encryptor,
-                                    new CryptoPP::StringSink(ciphertext),
-                                    false,  // Do not append authentication tag,
-                                            // (already included in CCM)
-                                    tagSize // Specify authentication tag length
-                                    ));
-                    break;
-                }
-                case AESMode::EAX: {
-                    CryptoPP::EAX<CryptoPP::AES>::Encryption encryptor;
-                    encryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::AuthenticatedEncryptionFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext)));
-                    break;
-                }
-                case AESMode::GCM: {
-                    CryptoPP::GCM<CryptoPP::AES>::Encryption encryptor;
-                    encryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(plaintext, true,
-                               new CryptoPP::AuthenticatedEncryptionFilter(
-                                       encryptor,
-                                       new CryptoPP::StringSink(ciphertext)));
-                    break;
-                }
-                default: {
-                    result.error = "Unsupported encryption mode: " +
-                            AESModeToString(mode);
-                    result.success = false;
-                    spdlog::error(result.error);
-                    return result;
-                }
+            auto context =
+                    acquireCipher(mode, true, keyBits, keyBlock, ivBlock);
+            if (!context) {
+                result.error = "Unsupported encryption mode: " +
+                        AESModeToString(mode);
+                result.success = false;
+                spdlog::error(result.error);
+                return result;
             }
 
+            std::string ciphertext;
+            CryptoPP::StringSource ss(
+                    plaintext, true,
+                    context->CreateFilter(new CryptoPP::StringSink(ciphertext),
+                                          getPaddingScheme(padding),
+                                          plaintext.size()));
+            releaseCipher(std::move(context));
+
             if (outputEncoding != EncodingFormat::NONE) {
                 ciphertext = processEncoding(ciphertext, outputEncoding, false);
             }
@@ -590,122 +659,184 @@ namespace CryptoToysPP::Algorithm::Advance {
                 return result;
             }
 
-            auto cryptoPadding = getPaddingScheme(padding);
+            auto context =
+                    acquireCipher(mode, false, keyBits, keyBlock, ivBlock);
+            if (!context) {
+                result.error = "Unsupported decryption mode: " +
+                        AESModeToString(mode);
+                result.success = false;
+                spdlog::error(result.error);
+                return result;
+            }
+
             std::string plaintext;
+            CryptoPP::StringSource ss(
+                    processedCiphertext, true,
+                    context->CreateFilter(new CryptoPP::StringSink(plaintext),
+                                          getPaddingScheme(padding),
+                                          processedCiphertext.size()));
+            releaseCipher(std::move(context));
 
-            switch (mode) {
-                case AESMode::ECB: {
-                    CryptoPP::ECB_Mode<CryptoPP::AES>::Decryption
-                            decryptor(keyBlock, keyBlock.size());
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext),
-                                       cryptoPadding));
-                    break;
-                }
-                case AESMode::CBC: {
-                    CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption
-                            decryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext),
-                                       cryptoPadding));
-                    break;
-                }
-                case AESMode::OFB: {
-                    CryptoPP::OFB_Mode<CryptoPP::AES>::Decryption
-                            decryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::CFB: {
-                    CryptoPP::CFB_Mode<CryptoPP::AES>::Decryption
-                            decryptor(keyBlock, keyBlock.size(), ivBlock);
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::XTS: {
-                    CryptoPP::XTS_Mode<CryptoPP::AES>::Decryption decryptor;
-                    decryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::StreamTransformationFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext),
-                                       CryptoPP::BlockPaddingSchemeDef::
-                                               NO_PADDING));
-                    break;
-                }
-                case AESMode::CCM: {
-                    CryptoPP::CCM<CryptoPP::AES>::Decryption decryptor;
-                    decryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-
-                    // Correct usage of SpecifyDataLengths (3 parameters)
-                    size_t tagSize = 12; // Must match encryption value
-                    size_t messageLength = processedCiphertext.size() - tagSize;
-                    decryptor.SpecifyDataLengths(0, messageLength, 0);
-
-                    CryptoPP::StringSource ss(
-                            processedCiphertext, true,
-                            new CryptoPP::AuthenticatedDecryptionFilter(
-                                    decryptor,
-                                    new CryptoPP::StringSink(plaintext),
-                                    CryptoPP::AuthenticatedDecryptionFilter::
-                                            DEFAULT_FLAGS,
-                                    tagSize // Specify authentication tag length
-                                    ));
-                    break;
-                }
-                case AESMode::EAX: {
-                    CryptoPP::EAX<CryptoPP::AES>::Decryption decryptor;
-                    decryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::AuthenticatedDecryptionFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext)));
-                    break;
-                }
-                case AESMode::GCM: {
-                    CryptoPP::GCM<CryptoPP::AES>::Decryption decryptor;
-                    decryptor.SetKeyWithIV(keyBlock, keyBlock.size(), ivBlock,
-                                           ivBlock.size());
-                    CryptoPP::StringSource
-                            ss(processedCiphertext, true,
-                               new CryptoPP::AuthenticatedDecryptionFilter(
-                                       decryptor,
-                                       new CryptoPP::StringSink(plaintext)));
-                    break;
-                }
-                default: {
-                    result.error = "Unsupported decryption mode: " +
-                            AESModeToString(mode);
-                    result.success = false;
-                    spdlog::error(result.error);
-                    return result;
-                }
+            result.data = plaintext;
+            result.success = true;
+            return result;
+        } catch (const CryptoPP::Exception &e) {
+            result.error = "Crypto++ exception: " + std::string(e.what());
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        } catch (const std::exception &e) {
+            result.error = "Standard exception: " + std::string(e.what());
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+    }
+
+    AES::Result AES::Encrypt(std::istream &input,
+                             std::ostream &output,
+                             AESMode mode,
+                             PaddingScheme padding,
+                             KeyBits keyBits,
+                             const std::string &key,
+                             const std::string &iv,
+                             EncodingFormat outputEncoding) {
+        Result result;
+
+        // Validate streaming mode padding requirements
+        if (!validateStreamingModePadding(mode, padding)) {
+            result.error = "Streaming modes require NO_PADDING";
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+
+        if (mode == AESMode::CCM) {
+            result.error = "CCM mode needs the message length upfront and "
+                           "cannot be used on streams";
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+
+        try {
+            CryptoPP::SecByteBlock keyBlock;
+            if (!initKey(keyBlock, key, keyBits, mode)) {
+                result.error = "Invalid key configuration";
+                result.success = false;
+                return result;
             }
 
-            result.data = plaintext;
+            CryptoPP::SecByteBlock ivBlock;
+            if (!initIV(ivBlock, iv, mode, true)) {
+                result.error = "IV generation failed";
+                result.success = false;
+                return result;
+            }
+
+            auto context =
+                    acquireCipher(mode, true, keyBits, keyBlock, ivBlock);
+            if (!context) {
+                result.error = "Unsupported encryption mode: " +
+                        AESModeToString(mode);
+                result.success = false;
+                spdlog::error(result.error);
+                return result;
+            }
+
+            // Sink chain: cipher -> [encoder] -> output stream
+            CryptoPP::BufferedTransformation *sink =
+                    new CryptoPP::FileSink(output);
+            if (outputEncoding == EncodingFormat::BASE64) {
+                sink = new CryptoPP::Base64Encoder(sink);
+            } else if (outputEncoding == EncodingFormat::HEX) {
+                sink = new CryptoPP::HexEncoder(sink);
+            }
+
+            CryptoPP::FileSource fs(
+                    input, true,
+                    context->CreateFilter(sink, getPaddingScheme(padding), 0));
+            releaseCipher(std::move(context));
+
+            result.success = true;
+            return result;
+        } catch (const CryptoPP::Exception &e) {
+            result.error = "Crypto++ exception: " + std::string(e.what());
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        } catch (const std::exception &e) {
+            result.error = "Standard exception: " + std::string(e.what());
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+    }
+
+    AES::Result AES::Decrypt(std::istream &input,
+                             std::ostream &output,
+                             AESMode mode,
+                             PaddingScheme padding,
+                             KeyBits keyBits,
+                             const std::string &key,
+                             const std::string &iv,
+                             EncodingFormat inputEncoding) {
+        Result result;
+
+        // Validate streaming mode padding requirements
+        if (!validateStreamingModePadding(mode, padding)) {
+            result.error = "Streaming modes require NO_PADDING";
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+
+        if (mode == AESMode::CCM) {
+            result.error = "CCM mode needs the message length upfront and "
+                           "cannot be used on streams";
+            result.success = false;
+            spdlog::error(result.error);
+            return result;
+        }
+
+        try {
+            CryptoPP::SecByteBlock keyBlock;
+            if (!initKey(keyBlock, key, keyBits, mode)) {
+                result.error = "Invalid key configuration";
+                result.success = false;
+                return result;
+            }
+
+            CryptoPP::SecByteBlock ivBlock;
+            if (!initIV(ivBlock, iv, mode, false)) {
+                result.error = "Invalid IV for decryption";
+                result.success = false;
+                return result;
+            }
+
+            auto context =
+                    acquireCipher(mode, false, keyBits, keyBlock, ivBlock);
+            if (!context) {
+                result.error = "Unsupported decryption mode: " +
+                        AESModeToString(mode);
+                result.success = false;
+                spdlog::error(result.error);
+                return result;
+            }
+
+            // Source chain: input stream -> [decoder] -> cipher -> output
+            CryptoPP::BufferedTransformation *filter = context->CreateFilter(
+                    new CryptoPP::FileSink(output), getPaddingScheme(padding),
+                    0);
+            if (inputEncoding == EncodingFormat::BASE64) {
+                filter = new CryptoPP::Base64Decoder(filter);
+            } else if (inputEncoding == EncodingFormat::HEX) {
+                filter = new CryptoPP::HexDecoder(filter);
+            }
+
+            CryptoPP::FileSource fs(input, true, filter);
+            releaseCipher(std::move(context));
+
             result.success = true;
             return result;
         } catch (const CryptoPP::Exception &e) {
@@ -27,6 +27,9 @@
 /* clang-format on */
 #ifndef AES_H
 #define AES_H
+#include <istream>
+#include <memory>
+#include <ostream>
 #include <string>
 #include <cryptopp/filters.h>
 namespace CryptoToysPP::Algorithm::Advance {
@@ -86,11 +89,55 @@ namespace CryptoToysPP::Algorithm::Advance {
                               const std::string &iv,
                               EncodingFormat inputEncoding);
 
+        // Stream variants: input is pumped in fixed-size blocks and output is
+        // written as it is produced, so memory use stays bounded. Result.data
+        // is left empty. CCM is rejected since it needs the length upfront.
+        // On failure the partial output must be discarded.
+        static Result Encrypt(std::istream &input,
+                              std::ostream &output,
+                              AESMode mode,
+                              PaddingScheme padding,
+                              KeyBits keyBits,
+                              const std::string &key,
+                              const std::string &iv,
+                              EncodingFormat outputEncoding);
+
+        static Result Decrypt(std::istream &input,
+                              std::ostream &output,
+                              AESMode mode,
+                              PaddingScheme padding,
+                              KeyBits keyBits,
+                              const std::string &key,
+                              const std::string &iv,
+                              EncodingFormat inputEncoding);
+
+        // Drop every cached cipher context; their key schedules are wiped
+        static void ClearCipherCache();
+
     private:
         static constexpr size_t AES_BLOCK_SIZE = 16;
         static constexpr size_t CCM_MIN_IV_SIZE = 7;
         static constexpr size_t CCM_MAX_IV_SIZE = 13;
         static constexpr size_t RECOMMENDED_CCM_IV_SIZE = 12; // NIST recommend
+        static constexpr size_t CCM_TAG_SIZE = 12;
+        static constexpr size_t CIPHER_CACHE_CAPACITY = 64;
+
+        // Keyed cipher objects are reused across calls so repeated use of a
+        // key skips key expansion (and GCM table setup). A context is checked
+        // out exclusively while in use and returned to the cache afterwards.
+        struct CipherContext;
+        struct CipherCache;
+
+        static std::unique_ptr<CipherContext>
+        acquireCipher(AESMode mode,
+                      bool encryption,
+                      KeyBits keyBits,
+                      const CryptoPP::SecByteBlock &keyBlock,
+                      const CryptoPP::SecByteBlock &ivBlock);
+
+        static void releaseCipher(std::unique_ptr<CipherContext> context);
+
+        static CipherCache &getCipherCache();
 
         static bool initKey(CryptoPP::SecByteBlock &keyBlock,
                             const std::string &keyStr,
@@ -26,15 +26,19 @@
  */
 /* clang-format on */
 #include "rsa.h"
+#include "rsa_key_pool.h"
+#include "algorithm/common/lru_cache.h"
 #include <cryptopp/base64.h>
 #include <cryptopp/cryptlib.h>
 #include <cryptopp/filters.h>
 #include <cryptopp/osrng.h>
 #include <cryptopp/rsa.h>
+#include <cryptopp/sha.h>
 #include <spdlog/spdlog.h>
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <mutex>
 #include <ranges>
 namespace CryptoToysPP::Algorithm::Advance {
     // Helper function: Convert CryptoPP::Integer to hexadecimal string
@@ -160,10 +164,16 @@ namespace CryptoToysPP::Algorithm::Advance {
                      static_cast<unsigned>(keySize));
 
         try {
-            CryptoPP::AutoSeededRandomPool rng{};
+            // Prefer a pre-generated key; generate inline when none is ready
             CryptoPP::RSA::PrivateKey privKey;
-            privKey.GenerateRandomWithKeySize(rng,
-                                              static_cast<unsigned>(keySize));
+            if (auto pooled = RSAKeyPool::Instance().TryTake(keySize)) {
+                privKey = std::move(*pooled);
+                spdlog::debug("Using pre-generated RSA key from the pool");
+            } else {
+                CryptoPP::AutoSeededRandomPool rng{};
+                privKey.GenerateRandomWithKeySize(
+                        rng, static_cast<unsigned>(keySize));
+            }
             CryptoPP::RSA::PublicKey pubKey;
             pubKey.Initialize(privKey.GetModulus(), privKey.GetPublicExponent());
 
@@ -517,16 +527,100 @@ namespace CryptoToysPP::Algorithm::Advance {
         return result;
     }
 
+    // Keys are immutable once parsed, so one instance is shared by every
+    // caller; the private key keeps its CRT parameters (p, q, dp, dq, u)
+    struct RSA::KeyCache {
+        std::mutex mutex;
+        Common::LruCache<std::string, PublicKeyPtr> publicKeys{
+                KEY_CACHE_CAPACITY};
+        Common::LruCache<std::string, PrivateKeyPtr> privateKeys{
+                KEY_CACHE_CAPACITY};
+    };
+
+    RSA::KeyCache &RSA::GetKeyCache() {
+        static KeyCache cache;
+        return cache;
+    }
+
+    void RSA::ClearKeyCache() {
+        auto &cache = GetKeyCache();
+        std::lock_guard lock(cache.mutex);
+        cache.publicKeys.Clear();
+        cache.privateKeys.Clear();
+    }
+
+    std::string RSA::KeyCacheKey(const std::string &keyStr,
+                                 PEMFormatType format) {
+        std::string cacheKey(1, static_cast<char>(format));
+        cacheKey.resize(1 + CryptoPP::SHA256::DIGESTSIZE);
+        CryptoPP::SHA256().CalculateDigest(
+                reinterpret_cast<CryptoPP::byte *>(cacheKey.data() + 1),
+                reinterpret_cast<const CryptoPP::byte *>(keyStr.data()),
+                keyStr.size());
+        return cacheKey;
+    }
+
+    RSA::Result RSA::AcquirePublicKey(const std::string &keyStr,
+                                      PEMFormatType format,
+                                      PublicKeyPtr &key) {
+        const std::string cacheKey = KeyCacheKey(keyStr, format);
+        auto &cache = GetKeyCache();
+        {
+            std::lock_guard lock(cache.mutex);
+            if (const auto *cached = cache.publicKeys.Find(cacheKey)) {
+                key = *cached;
+                return {"", true, ""};
+            }
+        }
+
+        // Parse outside the lock; a concurrent miss on the same key just
+        // parses it twice
+        auto loaded = std::make_shared<CryptoPP::RSA::PublicKey>();
+        Result result = LoadPublicKey(keyStr, *loaded, format);
+        if (!result.success)
+            return result;
+
+        key = loaded;
+        std::lock_guard lock(cache.mutex);
+        cache.publicKeys.Put(cacheKey, key);
+        return result;
+    }
+
+    RSA::Result RSA::AcquirePrivateKey(const std::string &keyStr,
+                                       PEMFormatType format,
+                                       PrivateKeyPtr &key) {
+        const std::string cacheKey = KeyCacheKey(keyStr, format);
+        auto &cache = GetKeyCache();
+        {
+            std::lock_guard lock(cache.mutex);
+            if (const auto *cached = cache.privateKeys.Find(cacheKey)) {
+                key = *cached;
+                return {"", true, ""};
+            }
+        }
+
+        auto loaded = std::make_shared<CryptoPP::RSA::PrivateKey>();
+        Result result = LoadPrivateKey(keyStr, *loaded, format);
+        if (!result.success)
+            return result;
+
+        key = loaded;
+        std::lock_guard lock(cache.mutex);
+        cache.privateKeys.Put(cacheKey, key);
+        return result;
+    }
+
     RSA::Result RSA::Encrypt(const std::string &plainText,
                              const std::string &pubKeyStr,
                              PEMFormatType format,
                              PaddingScheme padding) {
         Result result;
-        CryptoPP::RSA::PublicKey pubKey;
+        PublicKeyPtr pubKeyPtr;
 
-        result = LoadPublicKey(pubKeyStr, pubKey, format);
+        result = AcquirePublicKey(pubKeyStr, format, pubKeyPtr);
         if (!result.success)
             return result;
+        const CryptoPP::RSA::PublicKey &pubKey = *pubKeyPtr;
 
         spdlog::debug("Encrypting {} bytes with padding scheme: {}",
                      plainText.size(), PaddingSchemeToString(padding));
@@ -630,11 +724,12 @@ namespace CryptoToysPP::Algorithm::Advance {
                              PEMFormatType format,
                              PaddingScheme padding) {
         Result result;
-        CryptoPP::RSA::PrivateKey privKey;
+        PrivateKeyPtr privKeyPtr;
 
-        result = LoadPrivateKey(privKeyStr, privKey, format);
+        result = AcquirePrivateKey(privKeyStr, format, privKeyPtr);
         if (!result.success)
             return result;
+        const CryptoPP::RSA::PrivateKey &privKey = *privKeyPtr;
 
         spdlog::debug("Decrypting {} bytes with padding scheme: {}",
                      cipherText.size(), PaddingSchemeToString(padding));
@@ -27,6 +27,7 @@
 /* clang-format on */
 #ifndef RSA_H
 #define RSA_H
+#include <memory>
 #include <string>
 #include <utility>
 #include <cryptopp/rsa.h>
@@ -91,7 +92,29 @@ namespace CryptoToysPP::Algorithm::Advance {
                 PEMFormatType format = PEMFormatType::PKCS,
                 PaddingScheme padding = PaddingScheme::OAEP_SHA256);
 
+        // Drop every cached parsed key
+        static void ClearKeyCache();
+
     private:
+        static constexpr size_t KEY_CACHE_CAPACITY = 32;
+
+        // Parsed keys keyed by a digest of the PEM text and its format
+        struct KeyCache;
+        static KeyCache &GetKeyCache();
+        static std::string KeyCacheKey(const std::string &keyStr,
+                                       PEMFormatType format);
+
+        using PublicKeyPtr = std::shared_ptr<const CryptoPP::RSA::PublicKey>;
+        using PrivateKeyPtr = std::shared_ptr<const CryptoPP::RSA::PrivateKey>;
+
+        // Return a shared parsed key, loading and validating it on a miss
+        static Result AcquirePublicKey(const std::string &keyStr,
+                                       PEMFormatType format,
+                                       PublicKeyPtr &key);
+        static Result AcquirePrivateKey(const std::string &keyStr,
+                                        PEMFormatType format,
+                                        PrivateKeyPtr &key);
+
         // Internal PEM handlers
         static Result EncodePEM(const CryptoPP::RSA::PrivateKey &key,
                                 PEMFormatType format);
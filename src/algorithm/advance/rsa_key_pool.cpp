@@ -0,0 +1,210 @@
+/* clang-format off */
+/*
+ * @file rsa_key_pool.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "rsa_key_pool.h"
+#include <algorithm>
+#include <cryptopp/osrng.h>
+#include <spdlog/spdlog.h>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+namespace CryptoToysPP::Algorithm::Advance {
+    namespace {
+        // Generators should only use otherwise idle cores
+        void LowerCurrentThreadPriority() {
+#if defined(_WIN32)
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+            // Linux applies nice values per thread
+            setpriority(PRIO_PROCESS,
+                        static_cast<id_t>(syscall(SYS_gettid)), 10);
+#elif defined(__APPLE__)
+            pthread_set_qos_class_self_np(QOS_CLASS_BACKGROUND, 0);
+#endif
+        }
+    } // namespace
+
+    RSAKeyPool &RSAKeyPool::Instance() {
+        static RSAKeyPool pool;
+        return pool;
+    }
+
+    RSAKeyPool::~RSAKeyPool() {
+        Stop();
+    }
+
+    void RSAKeyPool::Start(const Options &newOptions) {
+        Stop();
+
+        std::lock_guard lock(mutex);
+        options = newOptions;
+        if (options.keysPerSize == 0 || options.keySizes.empty())
+            return;
+
+        size_t threads = options.threads;
+        if (threads == 0) {
+            // One generator per four cores, never more than two
+            const unsigned hardware = std::thread::hardware_concurrency();
+            threads = std::clamp<size_t>(hardware / 4, 1, 2);
+        }
+
+        running = true;
+        for (size_t i = 0; i < threads; ++i) {
+            generators.emplace_back(&RSAKeyPool::GeneratorLoop, this);
+        }
+        spdlog::info("RSA key pool started: {} keys per size, {} generators",
+                     options.keysPerSize, threads);
+    }
+
+    void RSAKeyPool::StartLazily(const Options &newOptions) {
+        Stop();
+        std::lock_guard lock(mutex);
+        deferred = newOptions;
+    }
+
+    void RSAKeyPool::Stop() {
+        std::vector<std::thread> stopping;
+        {
+            std::lock_guard lock(mutex);
+            running = false;
+            deferred.reset();
+            stopping.swap(generators);
+        }
+        wakeup.notify_all();
+        for (auto &generator : stopping) {
+            if (generator.joinable())
+                generator.join();
+        }
+
+        std::lock_guard lock(mutex);
+        pools.clear();
+        inFlight.clear();
+    }
+
+    std::optional<CryptoPP::RSA::PrivateKey>
+    RSAKeyPool::TryTake(RSA::KeySize size) {
+        std::optional<CryptoPP::RSA::PrivateKey> key;
+        std::optional<Options> startWith;
+        {
+            std::lock_guard lock(mutex);
+            const auto it = pools.find(size);
+            if (it == pools.end() || it->second.empty()) {
+                ++stats.misses;
+                startWith.swap(deferred);
+            } else {
+                key.emplace(std::move(it->second.front()));
+                it->second.pop_front();
+                ++stats.hits;
+            }
+        }
+        if (startWith) {
+            // This request is served inline while the pool fills
+            Start(*startWith);
+        } else if (key) {
+            wakeup.notify_one();
+        }
+        return key;
+    }
+
+    size_t RSAKeyPool::Available(RSA::KeySize size) {
+        std::lock_guard lock(mutex);
+        const auto it = pools.find(size);
+        return it == pools.end() ? 0 : it->second.size();
+    }
+
+    RSAKeyPool::Stats RSAKeyPool::GetStats() {
+        std::lock_guard lock(mutex);
+        return stats;
+    }
+
+    std::optional<RSA::KeySize> RSAKeyPool::NextToGenerate() const {
+        std::optional<RSA::KeySize> next;
+        size_t largestShortfall = 0;
+        // Sizes are listed in priority order; ties go to the earlier one
+        for (const auto size : options.keySizes) {
+            const auto pool = pools.find(size);
+            const auto pending = inFlight.find(size);
+            size_t have = pool == pools.end() ? 0 : pool->second.size();
+            if (pending != inFlight.end())
+                have += pending->second;
+            if (have < options.keysPerSize &&
+                options.keysPerSize - have > largestShortfall) {
+                largestShortfall = options.keysPerSize - have;
+                next = size;
+            }
+        }
+        return next;
+    }
+
+    void RSAKeyPool::GeneratorLoop() {
+        LowerCurrentThreadPriority();
+        CryptoPP::AutoSeededRandomPool rng;
+
+        while (true) {
+            RSA::KeySize size;
+            {
+                std::unique_lock lock(mutex);
+                wakeup.wait(lock, [this] {
+                    return !running || NextToGenerate().has_value();
+                });
+                if (!running)
+                    return;
+                size = *NextToGenerate();
+                ++inFlight[size];
+            }
+
+            std::optional<CryptoPP::RSA::PrivateKey> key;
+            try {
+                key.emplace();
+                key->GenerateRandomWithKeySize(rng,
+                                               static_cast<unsigned>(size));
+            } catch (const std::exception &e) {
+                spdlog::error("RSA key pool generation failed: {}", e.what());
+                key.reset();
+            }
+
+            std::lock_guard lock(mutex);
+            --inFlight[size];
+            if (!running)
+                return;
+            if (key) {
+                pools[size].push_back(std::move(*key));
+                spdlog::debug("RSA key pool: {}-bit key ready ({} available)",
+                              static_cast<unsigned>(size), pools[size].size());
+            }
+        }
+    }
+} // namespace CryptoToysPP::Algorithm::Advance
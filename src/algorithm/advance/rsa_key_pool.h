@@ -0,0 +1,111 @@
+/* clang-format off */
+/*
+ * @file rsa_key_pool.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef RSA_KEY_POOL_H
+#define RSA_KEY_POOL_H
+#include "rsa.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Advance {
+    // Keeps ready RSA private keys per key size, generated by low-priority
+    // background threads, so RSA::GenerateKeyPair can skip prime generation.
+    // Keys are stored unencoded and serialized in whatever PEM format the
+    // caller asks for. Until Start() is called the pool is empty and every
+    // request falls back to inline generation; StartLazily() defers that
+    // to the first request, so sessions that never generate keys never
+    // pay for (or wait on) the generators.
+    class RSAKeyPool {
+    public:
+        struct Options {
+            // Ready keys kept per size
+            size_t keysPerSize = 2;
+            // Sizes to pre-generate; other sizes are always generated
+            // inline. 4096-bit keys take seconds each and Stop() cannot
+            // interrupt them, so they are left out by default.
+            std::vector<RSA::KeySize> keySizes = {RSA::KeySize::KS_2048,
+                                                  RSA::KeySize::KS_3072};
+            // Background generator threads (0: derive from the core count)
+            size_t threads = 0;
+        };
+
+        struct Stats {
+            size_t hits = 0;   // Requests served from the pool
+            size_t misses = 0; // Requests that had to generate inline
+        };
+
+        static RSAKeyPool &Instance();
+
+        RSAKeyPool(const RSAKeyPool &) = delete;
+
+        RSAKeyPool &operator=(const RSAKeyPool &) = delete;
+
+        // Start (or restart with new options) the background generators
+        void Start(const Options &options);
+
+        // Start with `options` on the first TryTake()
+        void StartLazily(const Options &options);
+
+        // Stop the generators and wipe pooled keys. Waits for keys that are
+        // being generated, which may take a few seconds for large sizes.
+        void Stop();
+
+        // Take a ready key, or nothing if the pool for this size is empty
+        std::optional<CryptoPP::RSA::PrivateKey> TryTake(RSA::KeySize size);
+
+        [[nodiscard]] size_t Available(RSA::KeySize size);
+
+        [[nodiscard]] Stats GetStats();
+
+    private:
+        RSAKeyPool() = default;
+
+        ~RSAKeyPool();
+
+        void GeneratorLoop();
+
+        // Size with the largest shortfall, if any is below its target
+        std::optional<RSA::KeySize> NextToGenerate() const;
+
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        Options options;
+        std::map<RSA::KeySize, std::deque<CryptoPP::RSA::PrivateKey>> pools;
+        std::map<RSA::KeySize, size_t> inFlight;
+        std::vector<std::thread> generators;
+        Stats stats;
+        bool running = false;
+        std::optional<Options> deferred; // Set by StartLazily()
+    };
+} // namespace CryptoToysPP::Algorithm::Advance
+
+#endif // RSA_KEY_POOL_H
@@ -26,62 +26,144 @@
  */
 /* clang-format on */
 #include "base100.h"
+#include "base100_simd.h"
+#include "algorithm/common/byte_buffer.h"
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base100::Encode(const std::vector<uint8_t> &data) {
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> result;
-        result.reserve(data.size() * 4);
+    size_t Base100::MaxEncodedSize(size_t size) {
+        return size * 4;
+    }
 
-        for (const auto ch : data) {
-            const uint32_t temp = static_cast<uint32_t>(ch) + 55;
-            uint8_t byte3 = (temp >> 6) + 143;
-            uint8_t byte4 = (temp & 0x3F) + 128;
+    size_t Base100::MaxDecodedSize(size_t size) {
+        return size / 4;
+    }
 
-            result.push_back(0xF0);
-            result.push_back(0x9F);
-            result.push_back(byte3);
-            result.push_back(byte4);
+    size_t Base100::Encode(std::span<const uint8_t> in,
+                           std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        const size_t done =
+                Detail::Base100EncodeBulk(in.data(), in.size(), out.data());
+        uint8_t *cursor = out.data() + done * 4;
+        for (const auto ch : in.subspan(done)) {
+            const uint32_t temp = static_cast<uint32_t>(ch) + 55;
+            *cursor++ = 0xF0;
+            *cursor++ = 0x9F;
+            *cursor++ = static_cast<uint8_t>((temp >> 6) + 143);
+            *cursor++ = static_cast<uint8_t>((temp & 0x3F) + 128);
         }
-        return result;
+        return in.size() * 4;
     }
 
-    std::vector<uint8_t> Base100::Decode(const std::vector<uint8_t> &data) {
-        std::vector<uint8_t> result;
-
-        if (data.empty() || data.size() % 4 != 0)
-            return {};
-        result.reserve(data.size() / 4);
+    std::optional<size_t> Base100::Decode(std::span<const uint8_t> in,
+                                          std::span<uint8_t> out) {
+        if (in.size() % 4 != 0)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
 
-        for (size_t i = 0; i < data.size(); i += 4) {
-            if (data[i] != 0xF0 || data[i + 1] != 0x9F)
-                return {};
+        // The vector kernel applies the same checks, so it only stops
+        // early on input rejected within its last block
+        const size_t done =
+                Detail::Base100DecodeBulk(in.data(), in.size(), out.data());
+        uint8_t *cursor = out.data() + done / 4;
+        for (size_t i = done; i < in.size(); i += 4) {
+            if (in[i] != 0xF0 || in[i + 1] != 0x9F)
+                return std::nullopt;
 
-            const uint8_t byte3 = data[i + 2];
-            const uint8_t byte4 = data[i + 3];
+            const uint8_t byte3 = in[i + 2];
+            const uint8_t byte4 = in[i + 3];
 
             int32_t decoded = ((byte3 - 143) << 6) | (byte4 - 128);
             decoded -= 55;
 
             if (decoded < 0 || decoded > 255)
-                return {};
+                return std::nullopt;
+
+            *cursor++ = static_cast<uint8_t>(decoded);
+        }
+        return in.size() / 4;
+    }
+
+    size_t Base100::StreamEncoder::MaxUpdateSize(size_t size) {
+        return size * 4;
+    }
+
+    size_t Base100::StreamEncoder::Update(std::span<const uint8_t> in,
+                                          std::span<uint8_t> out) {
+        return Encode(in, out);
+    }
 
-            result.push_back(static_cast<uint8_t>(decoded));
+    size_t Base100::StreamEncoder::Finish(std::span<uint8_t>) {
+        return 0;
+    }
+
+    size_t Base100::StreamDecoder::MaxUpdateSize(size_t size) {
+        // Up to 3 pending bytes ahead of the new input
+        return (size + 3) / 4;
+    }
+
+    std::optional<size_t>
+    Base100::StreamDecoder::Update(std::span<const uint8_t> in,
+                                   std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        uint8_t *cursor = out.data();
+        if (count != 0) {
+            while (count < 4 && !in.empty()) {
+                group[count++] = in.front();
+                in = in.subspan(1);
+            }
+            if (count < 4)
+                return 0;
+            if (!Decode(group, {cursor, 1})) {
+                failed = true;
+                return std::nullopt;
+            }
+            ++cursor;
+            count = 0;
         }
-        return result;
+
+        const size_t whole = in.size() / 4 * 4;
+        if (!Decode(in.first(whole), {cursor, whole / 4})) {
+            failed = true;
+            return std::nullopt;
+        }
+        cursor += whole / 4;
+        for (const uint8_t byte : in.subspan(whole))
+            group[count++] = byte;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t> Base100::StreamDecoder::Finish(std::span<uint8_t>) {
+        const bool valid = !failed && count == 0;
+        *this = StreamDecoder();
+        if (!valid)
+            return std::nullopt;
+        return 0;
+    }
+
+    std::vector<uint8_t> Base100::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> Base100::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base100::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base100::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -0,0 +1,364 @@
+/* clang-format off */
+/*
+ * @file base100_simd.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "base100_simd.h"
+#include "algorithm/common/cpu.h"
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#elif defined(CRYPTOTOYSPP_NEON)
+#include <arm_neon.h>
+#endif
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    namespace {
+        using Kernel = size_t (*)(const uint8_t *, size_t, uint8_t *);
+
+        size_t None(const uint8_t *, size_t, uint8_t *) {
+            return 0;
+        }
+
+        // Each group is checked exactly as the scalar decoder does: with
+        // hi = b3 - 0x8F and lo = b4 - 0x80 it accepts 0 <= hi <= 4,
+        // 0 <= lo <= 127 and 55 <= (hi << 6 | lo) <= 310. Non-canonical
+        // groups with b4 >= 0xC0 pass as well, so the kernels compute the
+        // same value rather than only accepting encoder output.
+
+#if defined(CRYPTOTOYSPP_X86)
+        // ---- SSE4.1: 16 bytes <-> 64 bytes per step ----
+
+        // Third and fourth byte of each group; x + 55 wraps in 8 bits, so
+        // the carry into b3 comes from x >= 201
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline void EncodeTails(__m128i in, __m128i &b3, __m128i &b4) {
+            const __m128i sum = _mm_add_epi8(in, _mm_set1_epi8(55));
+            const __m128i carry = _mm_cmpeq_epi8(
+                    _mm_max_epu8(in, _mm_set1_epi8(static_cast<char>(201))),
+                    in);
+            b3 = _mm_add_epi8(
+                    _mm_add_epi8(
+                            _mm_and_si128(_mm_srli_epi16(sum, 6),
+                                          _mm_set1_epi8(0x03)),
+                            _mm_and_si128(carry, _mm_set1_epi8(0x04))),
+                    _mm_set1_epi8(static_cast<char>(0x8F)));
+            b4 = _mm_or_si128(_mm_and_si128(sum, _mm_set1_epi8(0x3F)),
+                              _mm_set1_epi8(static_cast<char>(0x80)));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSse41(const uint8_t *data, size_t len, uint8_t *out) {
+            const __m128i prefix = _mm_set1_epi16(static_cast<short>(0x9FF0));
+            size_t i = 0;
+            for (; len - i >= 16; i += 16, out += 64) {
+                __m128i b3, b4;
+                EncodeTails(_mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(data + i)),
+                            b3, b4);
+                const __m128i low = _mm_unpacklo_epi8(b3, b4);
+                const __m128i high = _mm_unpackhi_epi8(b3, b4);
+                auto *target = reinterpret_cast<__m128i *>(out);
+                _mm_storeu_si128(target, _mm_unpacklo_epi16(prefix, low));
+                _mm_storeu_si128(target + 1, _mm_unpackhi_epi16(prefix, low));
+                _mm_storeu_si128(target + 2, _mm_unpacklo_epi16(prefix, high));
+                _mm_storeu_si128(target + 3, _mm_unpackhi_epi16(prefix, high));
+            }
+            return i;
+        }
+
+        // Decoded values of 8 groups held as 16-bit words b3 | b4 << 8;
+        // `valid` collects the lanes that pass the scalar checks
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeWords(__m128i words, __m128i &valid) {
+            const __m128i hi = _mm_sub_epi16(
+                    _mm_and_si128(words, _mm_set1_epi16(0xFF)),
+                    _mm_set1_epi16(0x8F));
+            const __m128i lo =
+                    _mm_sub_epi16(_mm_srli_epi16(words, 8), _mm_set1_epi16(0x80));
+            const __m128i value = _mm_sub_epi16(
+                    _mm_or_si128(_mm_slli_epi16(hi, 6), lo), _mm_set1_epi16(55));
+            valid = _mm_and_si128(
+                    valid,
+                    _mm_and_si128(
+                            _mm_cmpeq_epi16(_mm_min_epu16(hi, _mm_set1_epi16(4)),
+                                            hi),
+                            _mm_cmpeq_epi16(
+                                    _mm_min_epu16(lo, _mm_set1_epi16(127)),
+                                    lo)));
+            valid = _mm_and_si128(
+                    valid,
+                    _mm_cmpeq_epi16(_mm_min_epu16(value, _mm_set1_epi16(255)),
+                                    value));
+            return value;
+        }
+
+        // Prefix check of 4 groups, then their b3/b4 words
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i LoadGroups(const uint8_t *data, __m128i &valid) {
+            const __m128i groups =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            valid = _mm_and_si128(
+                    valid,
+                    _mm_cmpeq_epi32(
+                            _mm_and_si128(groups, _mm_set1_epi32(0xFFFF)),
+                            _mm_set1_epi32(0x9FF0)));
+            return _mm_srli_epi32(groups, 16);
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSse41(const uint8_t *data, size_t len, uint8_t *out) {
+            size_t i = 0;
+            for (; len - i >= 64; i += 64, out += 16) {
+                __m128i prefixes = _mm_set1_epi8(-1);
+                const __m128i g0 = LoadGroups(data + i, prefixes);
+                const __m128i g1 = LoadGroups(data + i + 16, prefixes);
+                const __m128i g2 = LoadGroups(data + i + 32, prefixes);
+                const __m128i g3 = LoadGroups(data + i + 48, prefixes);
+                __m128i valid = _mm_set1_epi8(-1);
+                const __m128i first =
+                        DecodeWords(_mm_packus_epi32(g0, g1), valid);
+                const __m128i second =
+                        DecodeWords(_mm_packus_epi32(g2, g3), valid);
+                if (_mm_movemask_epi8(_mm_and_si128(prefixes, valid)) !=
+                    0xFFFF)
+                    break;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                 _mm_packus_epi16(first, second));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 32 bytes <-> 128 bytes per step ----
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t EncodeAvx2(const uint8_t *data, size_t len, uint8_t *out) {
+            const __m256i prefix =
+                    _mm256_set1_epi16(static_cast<short>(0x9FF0));
+            size_t i = 0;
+            for (; len - i >= 32; i += 32, out += 128) {
+                const __m256i in = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i *>(data + i));
+                const __m256i sum = _mm256_add_epi8(in, _mm256_set1_epi8(55));
+                const __m256i carry = _mm256_cmpeq_epi8(
+                        _mm256_max_epu8(
+                                in, _mm256_set1_epi8(static_cast<char>(201))),
+                        in);
+                const __m256i b3 = _mm256_add_epi8(
+                        _mm256_add_epi8(
+                                _mm256_and_si256(_mm256_srli_epi16(sum, 6),
+                                                 _mm256_set1_epi8(0x03)),
+                                _mm256_and_si256(carry,
+                                                 _mm256_set1_epi8(0x04))),
+                        _mm256_set1_epi8(static_cast<char>(0x8F)));
+                const __m256i b4 = _mm256_or_si256(
+                        _mm256_and_si256(sum, _mm256_set1_epi8(0x3F)),
+                        _mm256_set1_epi8(static_cast<char>(0x80)));
+                // Unpacking works per 128-bit lane: a/b hold bytes 0-7 and
+                // 16-23, c/d bytes 8-15 and 24-31
+                const __m256i low = _mm256_unpacklo_epi8(b3, b4);
+                const __m256i high = _mm256_unpackhi_epi8(b3, b4);
+                const __m256i a = _mm256_unpacklo_epi16(prefix, low);
+                const __m256i b = _mm256_unpackhi_epi16(prefix, low);
+                const __m256i c = _mm256_unpacklo_epi16(prefix, high);
+                const __m256i d = _mm256_unpackhi_epi16(prefix, high);
+                auto *target = reinterpret_cast<__m256i *>(out);
+                _mm256_storeu_si256(target, _mm256_permute2x128_si256(a, b, 0x20));
+                _mm256_storeu_si256(target + 1,
+                                    _mm256_permute2x128_si256(c, d, 0x20));
+                _mm256_storeu_si256(target + 2,
+                                    _mm256_permute2x128_si256(a, b, 0x31));
+                _mm256_storeu_si256(target + 3,
+                                    _mm256_permute2x128_si256(c, d, 0x31));
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        inline __m256i DecodeWords(__m256i words, __m256i &valid) {
+            const __m256i hi = _mm256_sub_epi16(
+                    _mm256_and_si256(words, _mm256_set1_epi16(0xFF)),
+                    _mm256_set1_epi16(0x8F));
+            const __m256i lo = _mm256_sub_epi16(_mm256_srli_epi16(words, 8),
+                                                _mm256_set1_epi16(0x80));
+            const __m256i value = _mm256_sub_epi16(
+                    _mm256_or_si256(_mm256_slli_epi16(hi, 6), lo),
+                    _mm256_set1_epi16(55));
+            valid = _mm256_and_si256(
+                    valid,
+                    _mm256_and_si256(
+                            _mm256_cmpeq_epi16(
+                                    _mm256_min_epu16(hi, _mm256_set1_epi16(4)),
+                                    hi),
+                            _mm256_cmpeq_epi16(
+                                    _mm256_min_epu16(lo,
+                                                     _mm256_set1_epi16(127)),
+                                    lo)));
+            valid = _mm256_and_si256(
+                    valid,
+                    _mm256_cmpeq_epi16(
+                            _mm256_min_epu16(value, _mm256_set1_epi16(255)),
+                            value));
+            return value;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        inline __m256i LoadGroups(const uint8_t *data, __m256i &valid) {
+            const __m256i groups =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            valid = _mm256_and_si256(
+                    valid,
+                    _mm256_cmpeq_epi32(
+                            _mm256_and_si256(groups, _mm256_set1_epi32(0xFFFF)),
+                            _mm256_set1_epi32(0x9FF0)));
+            return _mm256_srli_epi32(groups, 16);
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t DecodeAvx2(const uint8_t *data, size_t len, uint8_t *out) {
+            // Packing is per lane, leaving the dwords of groups 0-3, 8-11,
+            // 16-19, 24-27 | 4-7, 12-15, 20-23, 28-31
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            size_t i = 0;
+            for (; len - i >= 128; i += 128, out += 32) {
+                __m256i prefixes = _mm256_set1_epi8(-1);
+                const __m256i g0 = LoadGroups(data + i, prefixes);
+                const __m256i g1 = LoadGroups(data + i + 32, prefixes);
+                const __m256i g2 = LoadGroups(data + i + 64, prefixes);
+                const __m256i g3 = LoadGroups(data + i + 96, prefixes);
+                __m256i valid = _mm256_set1_epi8(-1);
+                const __m256i first =
+                        DecodeWords(_mm256_packus_epi32(g0, g1), valid);
+                const __m256i second =
+                        DecodeWords(_mm256_packus_epi32(g2, g3), valid);
+                if (_mm256_movemask_epi8(_mm256_and_si256(prefixes, valid)) !=
+                    -1)
+                    break;
+                _mm256_storeu_si256(
+                        reinterpret_cast<__m256i *>(out),
+                        _mm256_permutevar8x32_epi32(
+                                _mm256_packus_epi16(first, second), order));
+            }
+            return i;
+        }
+#endif
+
+#if defined(CRYPTOTOYSPP_NEON)
+        // ---- NEON: 16 bytes <-> 64 bytes per step ----
+        // The 4-way (de)interleaving loads and stores do the group layout
+
+        size_t EncodeNeon(const uint8_t *data, size_t len, uint8_t *out) {
+            uint8x16x4_t groups;
+            groups.val[0] = vdupq_n_u8(0xF0);
+            groups.val[1] = vdupq_n_u8(0x9F);
+            size_t i = 0;
+            for (; len - i >= 16; i += 16, out += 64) {
+                const uint8x16_t in = vld1q_u8(data + i);
+                const uint8x16_t sum = vaddq_u8(in, vdupq_n_u8(55));
+                const uint8x16_t carry = vandq_u8(vcgeq_u8(in, vdupq_n_u8(201)),
+                                                  vdupq_n_u8(0x04));
+                groups.val[2] = vaddq_u8(vaddq_u8(vshrq_n_u8(sum, 6), carry),
+                                         vdupq_n_u8(0x8F));
+                groups.val[3] = vorrq_u8(vandq_u8(sum, vdupq_n_u8(0x3F)),
+                                         vdupq_n_u8(0x80));
+                vst4q_u8(out, groups);
+            }
+            return i;
+        }
+
+        inline uint16x8_t DecodeWords(uint8x8_t b3,
+                                      uint8x8_t b4,
+                                      uint16x8_t &valid) {
+            const uint16x8_t hi = vsubq_u16(vmovl_u8(b3), vdupq_n_u16(0x8F));
+            const uint16x8_t lo = vsubq_u16(vmovl_u8(b4), vdupq_n_u16(0x80));
+            const uint16x8_t value = vsubq_u16(
+                    vorrq_u16(vshlq_n_u16(hi, 6), lo), vdupq_n_u16(55));
+            valid = vandq_u16(valid, vcleq_u16(hi, vdupq_n_u16(4)));
+            valid = vandq_u16(valid, vcleq_u16(lo, vdupq_n_u16(127)));
+            valid = vandq_u16(valid, vcleq_u16(value, vdupq_n_u16(255)));
+            return value;
+        }
+
+        size_t DecodeNeon(const uint8_t *data, size_t len, uint8_t *out) {
+            size_t i = 0;
+            for (; len - i >= 64; i += 64, out += 16) {
+                const uint8x16x4_t groups = vld4q_u8(data + i);
+                uint16x8_t valid = vdupq_n_u16(0xFFFF);
+                const uint16x8_t first =
+                        DecodeWords(vget_low_u8(groups.val[2]),
+                                    vget_low_u8(groups.val[3]), valid);
+                const uint16x8_t second =
+                        DecodeWords(vget_high_u8(groups.val[2]),
+                                    vget_high_u8(groups.val[3]), valid);
+                const uint8x16_t prefixes =
+                        vandq_u8(vceqq_u8(groups.val[0], vdupq_n_u8(0xF0)),
+                                 vceqq_u8(groups.val[1], vdupq_n_u8(0x9F)));
+                if (vminvq_u8(prefixes) != 0xFF || vminvq_u16(valid) != 0xFFFF)
+                    break;
+                vst1q_u8(out, vcombine_u8(vmovn_u16(first), vmovn_u16(second)));
+            }
+            return i;
+        }
+#endif
+
+        Kernel SelectEncodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return EncodeAvx2;
+            if (features.sse41)
+                return EncodeSse41;
+#elif defined(CRYPTOTOYSPP_NEON)
+            if (features.neon)
+                return EncodeNeon;
+#endif
+            (void) features;
+            return None;
+        }
+
+        Kernel SelectDecodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return DecodeAvx2;
+            if (features.sse41)
+                return DecodeSse41;
+#elif defined(CRYPTOTOYSPP_NEON)
+            if (features.neon)
+                return DecodeNeon;
+#endif
+            (void) features;
+            return None;
+        }
+    } // namespace
+
+    size_t Base100EncodeBulk(const uint8_t *data, size_t len, uint8_t *out) {
+        static const Kernel kernel = SelectEncodeKernel();
+        return kernel(data, len, out);
+    }
+
+    size_t Base100DecodeBulk(const uint8_t *data, size_t len, uint8_t *out) {
+        static const Kernel kernel = SelectDecodeKernel();
+        return kernel(data, len, out);
+    }
+} // namespace CryptoToysPP::Algorithm::Base::Detail
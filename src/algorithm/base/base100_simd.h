@@ -0,0 +1,48 @@
+/* clang-format off */
+/*
+ * @file base100_simd.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BASE100_SIMD_H
+#define BASE100_SIMD_H
+#include <cstddef>
+#include <cstdint>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    // Base100 maps byte x to the 4-byte UTF-8 sequence F0 9F b3 b4 with
+    // b3 = 0x8F + (x + 55) / 64 and b4 = 0x80 + (x + 55) % 64.
+
+    // Encode as many bytes from the front of `data` as the active vector
+    // kernel handles; the caller finishes the remainder. Writes 4 bytes
+    // per input byte to `out` and returns the number of bytes consumed.
+    size_t Base100EncodeBulk(const uint8_t *data, size_t len, uint8_t *out);
+
+    // Decode whole 4-byte groups from the front of `data`, stopping before
+    // the first vector block holding a group the scalar decoder would
+    // reject. `out` must have room for len / 4 bytes. Returns the number
+    // of input bytes consumed (a multiple of 4, possibly 0).
+    size_t Base100DecodeBulk(const uint8_t *data, size_t len, uint8_t *out);
+} // namespace CryptoToysPP::Algorithm::Base::Detail
+
+#endif // BASE100_SIMD_H
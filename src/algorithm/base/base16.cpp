@@ -26,58 +26,163 @@
  */
 /* clang-format on */
 #include "base16.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/executor.h"
+#include "algorithm/common/hex.h"
+#include <atomic>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base16::Encode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE16_CHARS[] = "0123456789ABCDEF";
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> encoded;
-        encoded.reserve(data.size() * 2);
-
-        for (const uint8_t c : data) {
-            encoded.push_back(BASE16_CHARS[c >> 4]);
-            encoded.push_back(BASE16_CHARS[c & 0x0F]);
+    namespace {
+        // Inputs from this size on are split across the shared executor
+        constexpr size_t PARALLEL_THRESHOLD = 4 * 1024 * 1024;
+        constexpr size_t PARALLEL_GRAIN = 1024 * 1024;
+
+        bool UseParallel(size_t len) {
+            return len >= PARALLEL_THRESHOLD &&
+                    Common::Executor::Shared().ThreadCount() > 1;
+        }
+
+        // Serial pieces run on the shared hex engine
+        void EncodeSerial(const uint8_t *data, size_t len, uint8_t *out) {
+            Common::HexEncode({data, len}, out);
+        }
+
+        bool DecodeSerial(const uint8_t *data, size_t len, uint8_t *out) {
+            return Common::HexDecode({data, len}, out).has_value();
+        }
+
+        void EncodeInto(const uint8_t *data, size_t len, uint8_t *out) {
+            if (!UseParallel(len)) {
+                EncodeSerial(data, len, out);
+                return;
+            }
+            Common::Executor::Shared().ParallelFor(
+                    len, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+                        EncodeSerial(data + begin, end - begin,
+                                     out + begin * 2);
+                    });
+        }
+
+        // `len` must be even
+        bool DecodeInto(const uint8_t *data, size_t len, uint8_t *out) {
+            if (!UseParallel(len))
+                return DecodeSerial(data, len, out);
+            std::atomic<bool> valid{true};
+            Common::Executor::Shared().ParallelFor(
+                    len / 2, PARALLEL_GRAIN / 2, [&](size_t begin, size_t end) {
+                        if (valid.load(std::memory_order_relaxed) &&
+                            !DecodeSerial(data + begin * 2, (end - begin) * 2,
+                                          out + begin))
+                            valid.store(false, std::memory_order_relaxed);
+                    });
+            return valid.load();
         }
-        return encoded;
+    } // namespace
+
+    size_t Base16::MaxEncodedSize(size_t size) {
+        return size * 2;
     }
 
-    std::vector<uint8_t> Base16::Decode(const std::vector<uint8_t> &data) {
-        if (data.empty() || data.size() % 2 != 0)
-            return {};
-
-        auto char_to_nibble = [](const uint8_t c) -> int32_t {
-            if (std::isdigit(c))
-                return c - '0';
-            if (c >= 'A' && c <= 'F')
-                return c - 'A' + 10;
-            if (c >= 'a' && c <= 'f')
-                return c - 'a' + 10;
-            return -1;
-        };
-
-        std::vector<uint8_t> decoded;
-        decoded.reserve(data.size() / 2);
-        for (size_t i = 0; i < data.size(); i += 2) {
-            const int32_t hi = char_to_nibble(data[i]);
-            const int32_t lo = char_to_nibble(data[i + 1]);
-            if (hi == -1 || lo == -1)
-                return {};
-            decoded.push_back((hi << 4) | lo);
+    size_t Base16::MaxDecodedSize(size_t size) {
+        return size / 2;
+    }
+
+    size_t Base16::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        EncodeInto(in.data(), in.size(), out.data());
+        return in.size() * 2;
+    }
+
+    std::optional<size_t> Base16::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        if (in.size() % 2 != 0)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        if (!DecodeInto(in.data(), in.size(), out.data()))
+            return std::nullopt;
+        return in.size() / 2;
+    }
+
+    size_t Base16::StreamEncoder::MaxUpdateSize(size_t size) {
+        return size * 2;
+    }
+
+    size_t Base16::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        return Encode(in, out);
+    }
+
+    size_t Base16::StreamEncoder::Finish(std::span<uint8_t>) {
+        return 0;
+    }
+
+    size_t Base16::StreamDecoder::MaxUpdateSize(size_t size) {
+        // A pending digit ahead of the new input
+        return (size + 1) / 2;
+    }
+
+    std::optional<size_t>
+    Base16::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        uint8_t *cursor = out.data();
+        if (pending && !in.empty()) {
+            const uint8_t pair[] = {digit, in.front()};
+            if (!DecodeSerial(pair, 2, cursor)) {
+                failed = true;
+                return std::nullopt;
+            }
+            ++cursor;
+            pending = false;
+            in = in.subspan(1);
+        }
+
+        const size_t whole = in.size() / 2 * 2;
+        if (!DecodeInto(in.data(), whole, cursor)) {
+            failed = true;
+            return std::nullopt;
         }
-        return decoded;
+        cursor += whole / 2;
+        if (whole < in.size()) {
+            digit = in.back();
+            pending = true;
+        }
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t> Base16::StreamDecoder::Finish(std::span<uint8_t>) {
+        const bool valid = !failed && !pending;
+        *this = StreamDecoder();
+        if (!valid)
+            return std::nullopt;
+        return 0;
+    }
+
+    std::vector<uint8_t> Base16::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> Base16::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base16::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base16::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -26,81 +26,324 @@
  */
 /* clang-format on */
 #include "base32.h"
+#include "base32_simd.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base32::Encode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE32_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> encoded;
-        encoded.reserve((data.size() * 8 + 4) / 5 + 1);
-
-        int32_t buffer = 0, bits_left = 0;
-        for (const uint8_t c : data) {
-            buffer = (buffer << 8) | c;
-            bits_left += 8;
-
-            while (bits_left >= 5) {
-                const int32_t idx = (buffer >> (bits_left - 5)) & 0x1F;
-                encoded.push_back(BASE32_CHARS[idx]);
-                bits_left -= 5;
+    namespace {
+        using Detail::Base32Alphabet;
+
+        // Characters handled in scalar code after the vector kernel stops,
+        // before it is tried again
+        constexpr size_t SCALAR_RETRY_CHARS = 64;
+
+        const Base32Alphabet &GetAlphabet(Base32::Alphabet alphabet) {
+            switch (alphabet) {
+                case Base32::Alphabet::HEX:
+                    return Detail::BASE32_HEX;
+                case Base32::Alphabet::CROCKFORD:
+                    return Detail::BASE32_CROCKFORD;
+                case Base32::Alphabet::ZBASE32:
+                    return Detail::BASE32_ZBASE32;
+                default:
+                    return Detail::BASE32_RFC4648;
             }
         }
 
-        if (bits_left > 0) {
-            const int32_t idx = (buffer << (5 - bits_left)) & 0x1F;
-            encoded.push_back(BASE32_CHARS[idx]);
+        // Eight characters for the 40 bits of `group`
+        inline uint8_t *EncodeGroup(uint64_t group,
+                                    uint8_t *out,
+                                    const Base32Alphabet &alphabet) {
+            for (int32_t shift = 35; shift >= 0; shift -= 5)
+                *out++ = alphabet.chars[(group >> shift) & 0x1F];
+            return out;
         }
 
-        while (encoded.size() % 8 != 0) {
-            encoded.push_back('=');
+        // Encode the whole 5-byte groups of `data` (len is a multiple of 5)
+        uint8_t *EncodeGroups(const uint8_t *data,
+                              size_t len,
+                              uint8_t *out,
+                              const Base32Alphabet &alphabet) {
+            size_t i = Detail::Base32EncodeBulk(data, len, out, alphabet);
+            out += i / 5 * 8;
+            for (; i < len; i += 5) {
+                uint64_t group = 0;
+                for (size_t j = 0; j < 5; ++j)
+                    group = (group << 8) | data[i + j];
+                out = EncodeGroup(group, out, alphabet);
+            }
+            return out;
         }
-        return encoded;
-    }
 
-    std::vector<uint8_t> Base32::Decode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE32_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
-        if (data.empty())
-            return {};
-        std::vector table(256, -1);
-        for (int32_t i = 0; i < 32; ++i) {
-            const auto c = BASE32_CHARS[i];
-            table[c] = i;
-            table[tolower(c)] = i;
+        // Encode the `count` (< 5) bytes in `group` and pad to 8
+        // characters for padded alphabets
+        uint8_t *EncodeTail(uint64_t group,
+                            size_t count,
+                            uint8_t *out,
+                            const Base32Alphabet &alphabet) {
+            if (count == 0)
+                return out;
+            const size_t chars = (count * 8 + 4) / 5;
+            group <<= 40 - count * 8;
+            for (size_t k = 0; k < chars; ++k)
+                *out++ = alphabet.chars[(group >> (35 - 5 * k)) & 0x1F];
+            if (alphabet.pad != 0)
+                out = std::fill_n(out, 8 - chars, alphabet.pad);
+            return out;
+        }
+
+        // A final group of 1, 3 or 6 characters cannot come from whole
+        // bytes
+        constexpr bool ValidTail(size_t count) {
+            return count == 2 || count == 4 || count == 5 || count == 7;
+        }
+
+        // Decode eight characters at `data` into five bytes; false, with
+        // nothing written, if any of them is not a plain value
+        inline bool DecodeGroup(const uint8_t *data,
+                                uint8_t *out,
+                                const Base32Alphabet &alphabet) {
+            uint64_t group = 0;
+            uint8_t invalid = 0;
+            for (size_t k = 0; k < 8; ++k) {
+                const uint8_t value = alphabet.values[data[k]];
+                invalid |= value;
+                group = (group << 5) | (value & 0x1F);
+            }
+            if ((invalid & 0xE0) != 0)
+                return false;
+            for (int32_t shift = 32; shift >= 0; shift -= 8)
+                *out++ = static_cast<uint8_t>(group >> shift);
+            return true;
         }
-        std::vector<uint8_t> decoded;
-        decoded.reserve((data.size() * 5) / 8);
 
-        int32_t buffer = 0, bits_collected = 0;
-        for (const uint8_t c : data) {
-            if (c == '=')
-                break;
+        // Feed `len` characters through the decoder state: `group` holds
+        // `count` (< 8) pending values, `padding` the padding characters
+        // seen. Advances `out`; false on malformed input.
+        bool DecodeChars(const uint8_t *data,
+                         size_t len,
+                         uint8_t *&out,
+                         uint64_t &group,
+                         size_t &count,
+                         size_t &padding,
+                         const Base32Alphabet &alphabet) {
+            size_t i = 0;
+            while (i < len) {
+                if (count == 0 && padding == 0) {
+                    const size_t consumed = Detail::Base32DecodeBulk(
+                            data + i, len - i, out, alphabet);
+                    i += consumed;
+                    out += consumed / 8 * 5;
+                }
 
-            const int32_t idx = table[c];
-            if (idx == -1)
-                return {};
+                const size_t stop = std::min(len, i + SCALAR_RETRY_CHARS);
+                while (i < stop) {
+                    if (count == 0 && padding == 0 && len - i >= 8 &&
+                        DecodeGroup(data + i, out, alphabet)) {
+                        i += 8;
+                        out += 5;
+                        continue;
+                    }
 
-            buffer = (buffer << 5) | idx;
-            bits_collected += 5;
+                    const uint8_t c = data[i++];
+                    if (alphabet.pad != 0 && c == alphabet.pad) {
+                        if (padding == 0 && !ValidTail(count))
+                            return false;
+                        if (count + ++padding > 8)
+                            return false;
+                        continue;
+                    }
+                    const uint8_t value = alphabet.values[c];
+                    if (value == Detail::BASE32_SKIP)
+                        continue;
+                    if (value == Detail::BASE32_INVALID || padding != 0)
+                        return false;
 
-            if (bits_collected >= 8) {
-                decoded.push_back((buffer >> (bits_collected - 8)) & 0xFF);
-                bits_collected -= 8;
+                    group = (group << 5) | value;
+                    if (++count == 8) {
+                        for (int32_t shift = 32; shift >= 0; shift -= 8)
+                            *out++ = static_cast<uint8_t>(group >> shift);
+                        group = 0;
+                        count = 0;
+                    }
+                }
             }
+            return true;
         }
-        return decoded;
+
+        // Flush the final partial group; padding, if any, must complete it
+        bool DecodeTail(uint8_t *&out,
+                        uint64_t group,
+                        size_t count,
+                        size_t padding) {
+            if (count == 0)
+                return padding == 0;
+            if (!ValidTail(count) || (padding != 0 && count + padding != 8))
+                return false;
+            const size_t bits = count * 5;
+            for (size_t j = 0; j < bits / 8; ++j)
+                *out++ = static_cast<uint8_t>(group >> (bits - 8 * (j + 1)));
+            return true;
+        }
+    } // namespace
+
+    size_t Base32::MaxEncodedSize(size_t size) {
+        return (size + 4) / 5 * 8;
+    }
+
+    size_t Base32::MaxDecodedSize(size_t size) {
+        return size / 8 * 5 + size % 8 * 5 / 8;
+    }
+
+    size_t Base32::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out,
+                          Alphabet alphabet) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        const Base32Alphabet &table = GetAlphabet(alphabet);
+        const size_t whole = in.size() / 5 * 5;
+        uint8_t *cursor = EncodeGroups(in.data(), whole, out.data(), table);
+
+        uint64_t group = 0;
+        for (size_t i = whole; i < in.size(); ++i)
+            group = (group << 8) | in[i];
+        cursor = EncodeTail(group, in.size() - whole, cursor, table);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t> Base32::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out,
+                                         Alphabet alphabet) {
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        uint8_t *cursor = out.data();
+        uint64_t group = 0;
+        size_t count = 0, padding = 0;
+        if (!DecodeChars(in.data(), in.size(), cursor, group, count, padding,
+                         GetAlphabet(alphabet)) ||
+            !DecodeTail(cursor, group, count, padding))
+            return std::nullopt;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    Base32::StreamEncoder::StreamEncoder(Alphabet alphabet)
+        : alphabet(alphabet) {}
+
+    size_t Base32::StreamEncoder::MaxUpdateSize(size_t size) {
+        // Up to 4 pending bytes ahead of the new input
+        return (size + 4) / 5 * 8;
+    }
+
+    size_t Base32::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const Base32Alphabet &table = GetAlphabet(alphabet);
+        uint8_t *cursor = out.data();
+        size_t i = 0;
+        if (count != 0) {
+            for (; count < 5 && i < in.size(); ++i, ++count)
+                group = (group << 8) | in[i];
+            if (count < 5)
+                return 0;
+            cursor = EncodeGroup(group, cursor, table);
+            group = 0;
+            count = 0;
+        }
+
+        const size_t whole = (in.size() - i) / 5 * 5;
+        cursor = EncodeGroups(in.data() + i, whole, cursor, table);
+        for (i += whole; i < in.size(); ++i, ++count)
+            group = (group << 8) | in[i];
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base32::StreamEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const uint8_t *cursor =
+                EncodeTail(group, count, out.data(), GetAlphabet(alphabet));
+        group = 0;
+        count = 0;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    Base32::StreamDecoder::StreamDecoder(Alphabet alphabet)
+        : alphabet(alphabet) {}
+
+    size_t Base32::StreamDecoder::MaxUpdateSize(size_t size) {
+        // Up to 7 pending characters ahead of the new input
+        return (size + 7) / 8 * 5;
+    }
+
+    std::optional<size_t>
+    Base32::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        uint8_t *cursor = out.data();
+        if (!DecodeChars(in.data(), in.size(), cursor, group, count, padding,
+                         GetAlphabet(alphabet))) {
+            failed = true;
+            return std::nullopt;
+        }
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t>
+    Base32::StreamDecoder::Finish(std::span<uint8_t> out) {
+        uint8_t *cursor = out.data();
+        bool valid = !failed;
+        if (valid) {
+            Common::RequireCapacity(out, MAX_FINISH_SIZE);
+            valid = DecodeTail(cursor, group, count, padding);
+        }
+        *this = StreamDecoder(alphabet);
+        if (!valid)
+            return std::nullopt;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::vector<uint8_t> Base32::Encode(const std::vector<uint8_t> &data) {
+        return Encode(data, Alphabet::RFC4648);
+    }
+
+    std::vector<uint8_t> Base32::Decode(const std::vector<uint8_t> &data) {
+        return Decode(data, Alphabet::RFC4648);
     }
 
     std::string Base32::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Encode(data, Alphabet::RFC4648);
     }
 
     std::string Base32::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Decode(data, Alphabet::RFC4648);
+    }
+
+    std::vector<uint8_t> Base32::Encode(const std::vector<uint8_t> &data,
+                                        Alphabet alphabet) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(data, out, alphabet);
+                });
+    }
+
+    std::vector<uint8_t> Base32::Decode(const std::vector<uint8_t> &data,
+                                        Alphabet alphabet) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(data, out, alphabet);
+                });
+    }
+
+    std::string Base32::Encode(const std::string &data, Alphabet alphabet) {
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out, alphabet);
+                });
+    }
+
+    std::string Base32::Decode(const std::string &data, Alphabet alphabet) {
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out, alphabet);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -28,11 +28,19 @@
 #ifndef BASE32_H
 #define BASE32_H
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
+#include "algorithm/common/stream_codec.h"
 namespace CryptoToysPP::Algorithm::Base {
     class Base32 {
     public:
+        // RFC4648 and HEX (base32hex) are padded with '='; CROCKFORD and
+        // ZBASE32 are not. Decoding is case insensitive, Crockford also
+        // accepts I/L/O for 1/1/0 and ignores hyphens.
+        enum class Alphabet { RFC4648, HEX, CROCKFORD, ZBASE32 };
+
         static std::vector<uint8_t> Encode(const std::vector<uint8_t> &data);
 
         static std::vector<uint8_t> Decode(const std::vector<uint8_t> &data);
@@ -40,6 +48,87 @@ namespace CryptoToysPP::Algorithm::Base {
         static std::string Encode(const std::string &data);
 
         static std::string Decode(const std::string &data);
+
+        static std::vector<uint8_t> Encode(const std::vector<uint8_t> &data,
+                                           Alphabet alphabet);
+
+        static std::vector<uint8_t> Decode(const std::vector<uint8_t> &data,
+                                           Alphabet alphabet);
+
+        static std::string Encode(const std::string &data, Alphabet alphabet);
+
+        static std::string Decode(const std::string &data, Alphabet alphabet);
+
+        // Output sizes for the caller-provided buffers below
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out,
+                             Alphabet alphabet = Alphabet::RFC4648);
+
+        // Decode into `out` (MaxDecodedSize(in.size()) bytes); returns the
+        // bytes written, or std::nullopt for malformed input. Padding is
+        // optional, but when present it must complete the last group.
+        static std::optional<size_t>
+        Decode(std::span<const uint8_t> in,
+               std::span<uint8_t> out,
+               Alphabet alphabet = Alphabet::RFC4648);
+
+        // Incremental encoding: feeding the input in pieces gives the same
+        // output as a single Encode. Update needs MaxUpdateSize(in.size())
+        // bytes of room and Finish MAX_FINISH_SIZE.
+        class StreamEncoder : public Common::StreamEncoderBase<StreamEncoder> {
+        public:
+            using StreamEncoderBase::Finish;
+            using StreamEncoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 8;
+
+            explicit StreamEncoder(Alphabet alphabet = Alphabet::RFC4648);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            size_t Update(std::span<const uint8_t> in,
+                          std::span<uint8_t> out);
+
+            // Encode and pad the partial group and reset for a new stream
+            size_t Finish(std::span<uint8_t> out);
+
+        private:
+            Alphabet alphabet;
+            uint64_t group = 0; // pending input bytes, right-aligned
+            size_t count = 0;   // number of pending bytes, below 5
+        };
+
+        // Incremental decoding; after malformed input every call returns
+        // std::nullopt until Finish resets the decoder
+        class StreamDecoder : public Common::StreamDecoderBase<StreamDecoder> {
+        public:
+            using StreamDecoderBase::Finish;
+            using StreamDecoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 4;
+
+            explicit StreamDecoder(Alphabet alphabet = Alphabet::RFC4648);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            std::optional<size_t> Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out);
+
+            std::optional<size_t> Finish(std::span<uint8_t> out);
+
+        private:
+            Alphabet alphabet;
+            uint64_t group = 0;  // pending values, right-aligned
+            size_t count = 0;    // number of pending values, below 8
+            size_t padding = 0;  // padding characters seen
+            bool failed = false;
+        };
     };
 } // namespace CryptoToysPP::Algorithm::Base
 #endif // BASE32_H
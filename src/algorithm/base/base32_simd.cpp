@@ -0,0 +1,335 @@
+/* clang-format off */
+/*
+ * @file base32_simd.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "base32_simd.h"
+#include "algorithm/common/cpu.h"
+#include <cstring>
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#endif
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    namespace {
+        using EncodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const Base32Alphabet &);
+        using DecodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const Base32Alphabet &);
+
+        size_t EncodeNone(const uint8_t *, size_t, uint8_t *,
+                          const Base32Alphabet &) {
+            return 0;
+        }
+
+        size_t DecodeNone(const uint8_t *, size_t, uint8_t *,
+                          const Base32Alphabet &) {
+            return 0;
+        }
+
+        // Values of 16 characters, or false if any of them is padding, a
+        // skipped character or outside the alphabet. The alphabets are
+        // irregular, so the lookup stays scalar; it is branch-free per
+        // character.
+        inline bool LookupValues(const uint8_t *chars,
+                                 const Base32Alphabet &alphabet,
+                                 uint8_t *values) {
+            uint8_t invalid = 0;
+            for (size_t j = 0; j < 16; ++j) {
+                values[j] = alphabet.values[chars[j]];
+                invalid |= values[j];
+            }
+            return (invalid & 0xE0) == 0;
+        }
+
+#if defined(CRYPTOTOYSPP_X86)
+        // A 16-bit lane per output character holds the two input bytes
+        // its 5 bits straddle; a per-lane multiply-high shifts the field
+        // down (Mula & Lemire's Base64 technique applied to 5-bit fields).
+        // Values 0..31 become characters through two 16-entry shuffles.
+
+        // ---- SSE4.1: 10 bytes <-> 16 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i EncodeIndices(__m128i in) {
+            const __m128i shifts = _mm_setr_epi16(32, 1024, 128, 4096, 512, 64,
+                                                  2048, 256);
+            const __m128i mask = _mm_set1_epi16(0x1F);
+            const __m128i first = _mm_shuffle_epi8(
+                    in, _mm_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4,
+                                      3, 5, 4));
+            const __m128i second = _mm_shuffle_epi8(
+                    in, _mm_setr_epi8(6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9,
+                                      8, 10, 9));
+            return _mm_packus_epi16(
+                    _mm_and_si128(_mm_mulhi_epu16(first, shifts), mask),
+                    _mm_and_si128(_mm_mulhi_epu16(second, shifts), mask));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i EncodeTranslate(__m128i indices,
+                                       __m128i low,
+                                       __m128i high) {
+            return _mm_blendv_epi8(_mm_shuffle_epi8(low, indices),
+                                   _mm_shuffle_epi8(high, indices),
+                                   _mm_cmpgt_epi8(indices, _mm_set1_epi8(15)));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const Base32Alphabet &alphabet) {
+            const __m128i low = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(alphabet.chars));
+            const __m128i high = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(alphabet.chars + 16));
+            size_t i = 0;
+            // Each load reads 16 bytes but consumes 10
+            for (; len - i >= 16; i += 10, out += 16) {
+                const __m128i in = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i));
+                _mm_storeu_si128(
+                        reinterpret_cast<__m128i *>(out),
+                        EncodeTranslate(EncodeIndices(in), low, high));
+            }
+            return i;
+        }
+
+        // 16 values to 10 bytes: pairs and quads of fields are merged
+        // with multiply-adds, then the two 20-bit halves of each 40-bit
+        // group are joined and the bytes put in big-endian order
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodePack(__m128i values) {
+            const __m128i pairs =
+                    _mm_maddubs_epi16(values, _mm_set1_epi16(0x0120));
+            const __m128i halves =
+                    _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010400));
+            const __m128i groups = _mm_or_si128(
+                    _mm_and_si128(_mm_slli_epi64(halves, 20),
+                                  _mm_set1_epi64x(0xFFFFF00000)),
+                    _mm_srli_epi64(halves, 32));
+            return _mm_shuffle_epi8(groups,
+                                    _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10,
+                                                  9, 8, -1, -1, -1, -1, -1,
+                                                  -1));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline void Store10(uint8_t *out, __m128i bytes) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out), bytes);
+            const auto tail =
+                    static_cast<uint16_t>(_mm_extract_epi16(bytes, 4));
+            std::memcpy(out + 8, &tail, sizeof(tail));
+        }
+
+        // Characters to values through the alphabet's own table: every
+        // alphabet character is printable ASCII (0x20..0x7F), so six
+        // 16-entry shuffles keyed on the high nibble cover it. Anything
+        // else, padding and skipped characters end up >= 0x20.
+        constexpr int TABLE_FIRST = 2;
+        constexpr int TABLE_COUNT = 6;
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeTranslate(__m128i chars, const __m128i *tables) {
+            const __m128i high =
+                    _mm_and_si128(_mm_srli_epi16(chars, 4), _mm_set1_epi8(0x0F));
+            __m128i values = _mm_set1_epi8(static_cast<char>(BASE32_INVALID));
+            for (int k = 0; k < TABLE_COUNT; ++k) {
+                values = _mm_blendv_epi8(
+                        values, _mm_shuffle_epi8(tables[k], chars),
+                        _mm_cmpeq_epi8(high, _mm_set1_epi8(
+                                                     static_cast<char>(
+                                                             TABLE_FIRST + k))));
+            }
+            return values;
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const Base32Alphabet &alphabet) {
+            __m128i tables[TABLE_COUNT];
+            for (int k = 0; k < TABLE_COUNT; ++k)
+                tables[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                        alphabet.values + (TABLE_FIRST + k) * 16));
+            const __m128i top = _mm_set1_epi8(31);
+            size_t i = 0;
+            for (; len - i >= 16; i += 16, out += 10) {
+                const __m128i values = DecodeTranslate(
+                        _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(data + i)),
+                        tables);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(
+                            _mm_min_epu8(values, top), values)) != 0xFFFF)
+                    break;
+                Store10(out, DecodePack(values));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 20 bytes <-> 32 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t EncodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base32Alphabet &alphabet) {
+            const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(alphabet.chars)));
+            const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(alphabet.chars + 16)));
+            const __m256i shifts = _mm256_setr_epi16(
+                    32, 1024, 128, 4096, 512, 64, 2048, 256, 32, 1024, 128,
+                    4096, 512, 64, 2048, 256);
+            const __m256i mask = _mm256_set1_epi16(0x1F);
+            const __m256i firstShuffle = _mm256_broadcastsi128_si256(
+                    _mm_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5,
+                                  4));
+            const __m256i secondShuffle = _mm256_broadcastsi128_si256(
+                    _mm_setr_epi8(6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10,
+                                  9));
+            size_t i = 0;
+            // Two 16-byte loads 10 bytes apart; 20 bytes are consumed
+            for (; len - i >= 26; i += 20, out += 32) {
+                const __m256i in = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(_mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(data + i))),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                data + i + 10)),
+                        1);
+                const __m256i first = _mm256_and_si256(
+                        _mm256_mulhi_epu16(
+                                _mm256_shuffle_epi8(in, firstShuffle), shifts),
+                        mask);
+                const __m256i second = _mm256_and_si256(
+                        _mm256_mulhi_epu16(
+                                _mm256_shuffle_epi8(in, secondShuffle),
+                                shifts),
+                        mask);
+                const __m256i indices = _mm256_packus_epi16(first, second);
+                const __m256i chars = _mm256_blendv_epi8(
+                        _mm256_shuffle_epi8(low, indices),
+                        _mm256_shuffle_epi8(high, indices),
+                        _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(15)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), chars);
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t DecodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base32Alphabet &alphabet) {
+            __m256i tables[TABLE_COUNT];
+            for (int k = 0; k < TABLE_COUNT; ++k)
+                tables[k] = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                alphabet.values + (TABLE_FIRST + k) * 16)));
+            const __m256i top = _mm256_set1_epi8(31);
+            const __m256i order = _mm256_broadcastsi128_si256(
+                    _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1,
+                                  -1, -1, -1));
+            size_t i = 0;
+            for (; len - i >= 32; i += 32, out += 20) {
+                const __m256i chars = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i *>(data + i));
+                const __m256i high = _mm256_and_si256(
+                        _mm256_srli_epi16(chars, 4), _mm256_set1_epi8(0x0F));
+                __m256i values =
+                        _mm256_set1_epi8(static_cast<char>(BASE32_INVALID));
+                for (int k = 0; k < TABLE_COUNT; ++k) {
+                    values = _mm256_blendv_epi8(
+                            values, _mm256_shuffle_epi8(tables[k], chars),
+                            _mm256_cmpeq_epi8(
+                                    high, _mm256_set1_epi8(static_cast<char>(
+                                                  TABLE_FIRST + k))));
+                }
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                            _mm256_min_epu8(values, top), values)) != -1)
+                    break;
+
+                const __m256i pairs =
+                        _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120));
+                const __m256i halves =
+                        _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00010400));
+                const __m256i groups = _mm256_or_si256(
+                        _mm256_and_si256(_mm256_slli_epi64(halves, 20),
+                                         _mm256_set1_epi64x(0xFFFFF00000)),
+                        _mm256_srli_epi64(halves, 32));
+                const __m256i bytes = _mm256_shuffle_epi8(groups, order);
+                Store10(out, _mm256_castsi256_si128(bytes));
+                Store10(out + 10, _mm256_extracti128_si256(bytes, 1));
+            }
+            return i;
+        }
+#endif
+
+        EncodeKernel SelectEncodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return EncodeAvx2;
+            if (features.sse41)
+                return EncodeSse41;
+#endif
+            (void) features;
+            return EncodeNone;
+        }
+
+        DecodeKernel SelectDecodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return DecodeAvx2;
+            if (features.sse41)
+                return DecodeSse41;
+#endif
+            (void) features;
+            return DecodeNone;
+        }
+    } // namespace
+
+    size_t Base32EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base32Alphabet &alphabet) {
+        static const EncodeKernel kernel = SelectEncodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+
+    size_t Base32DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base32Alphabet &alphabet) {
+        static const DecodeKernel kernel = SelectDecodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+} // namespace CryptoToysPP::Algorithm::Base::Detail
@@ -0,0 +1,107 @@
+/* clang-format off */
+/*
+ * @file base32_simd.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BASE32_SIMD_H
+#define BASE32_SIMD_H
+#include <cstddef>
+#include <cstdint>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    inline constexpr uint8_t BASE32_INVALID = 0xFF;
+    inline constexpr uint8_t BASE32_SKIP = 0xFE; // ignored when decoding
+
+    // Alphabet shared by the scalar and vector kernels. Decoding is case
+    // insensitive for all variants.
+    struct Base32Alphabet {
+        uint8_t chars[32];   // value -> character
+        uint8_t values[256]; // character -> value, BASE32_INVALID/SKIP
+        uint8_t pad;         // padding character, 0 for unpadded variants
+    };
+
+    // `aliases` lists extra character/value pairs accepted when decoding
+    // and `skip` characters that are ignored (Crockford's '-')
+    constexpr Base32Alphabet MakeBase32Alphabet(const char *chars,
+                                                char pad,
+                                                const char *aliases = "",
+                                                const char *skip = "") {
+        Base32Alphabet alphabet{};
+        for (auto &value : alphabet.values)
+            value = BASE32_INVALID;
+        for (int i = 0; i < 32; ++i) {
+            const auto c = static_cast<uint8_t>(chars[i]);
+            alphabet.chars[i] = c;
+            alphabet.values[c] = static_cast<uint8_t>(i);
+            if (c >= 'A' && c <= 'Z')
+                alphabet.values[c - 'A' + 'a'] = static_cast<uint8_t>(i);
+            if (c >= 'a' && c <= 'z')
+                alphabet.values[c - 'a' + 'A'] = static_cast<uint8_t>(i);
+        }
+        for (; aliases[0] != 0; aliases += 2)
+            alphabet.values[static_cast<uint8_t>(aliases[0])] =
+                    alphabet.values[static_cast<uint8_t>(aliases[1])];
+        for (; skip[0] != 0; ++skip)
+            alphabet.values[static_cast<uint8_t>(skip[0])] = BASE32_SKIP;
+        alphabet.pad = static_cast<uint8_t>(pad);
+        return alphabet;
+    }
+
+    // RFC 4648 section 6
+    inline constexpr Base32Alphabet BASE32_RFC4648 =
+            MakeBase32Alphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZ234567", '=');
+
+    // RFC 4648 section 7, "base32hex"
+    inline constexpr Base32Alphabet BASE32_HEX =
+            MakeBase32Alphabet("0123456789ABCDEFGHIJKLMNOPQRSTUV", '=');
+
+    // Crockford's Base32: I/L read as 1, O as 0, hyphens ignored
+    inline constexpr Base32Alphabet BASE32_CROCKFORD = MakeBase32Alphabet(
+            "0123456789ABCDEFGHJKMNPQRSTVWXYZ", 0, "I1i1L1l1O0o0", "-");
+
+    // z-base-32 (Zooko's human-oriented variant)
+    inline constexpr Base32Alphabet BASE32_ZBASE32 =
+            MakeBase32Alphabet("ybndrfg8ejkmcpqxot1uwisza345h769", 0);
+
+    // Encode as many whole 5-byte groups from the front of `data` as the
+    // active vector kernel handles; the caller finishes the remainder.
+    // Writes 8 characters per group to `out` and returns the number of
+    // input bytes consumed (a multiple of 5, possibly 0).
+    size_t Base32EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base32Alphabet &alphabet);
+
+    // Decode whole 8-character groups from the front of `data`, stopping
+    // before the first vector block holding anything but the alphabet's
+    // characters (padding and skipped characters included). `out` must
+    // have room for len / 8 * 5 bytes. Returns the number of characters
+    // consumed (a multiple of 8, possibly 0).
+    size_t Base32DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base32Alphabet &alphabet);
+} // namespace CryptoToysPP::Algorithm::Base::Detail
+
+#endif // BASE32_SIMD_H
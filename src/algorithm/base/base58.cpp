@@ -26,97 +26,72 @@
  */
 /* clang-format on */
 #include "base58.h"
-#include <ranges>
+#include "radix.h"
+#include "algorithm/common/byte_buffer.h"
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base58::Encode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE58_CHARS[] =
-                "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-        if (data.empty())
-            return {};
-        size_t leading_zeros = 0;
-        while (leading_zeros < data.size() && data[leading_zeros] == 0) {
-            ++leading_zeros;
-        }
-        std::vector<int32_t> digits;
-        for (const uint8_t byte : data) {
-            int32_t carry = byte;
-            for (auto &digit : digits) {
-                carry += digit * 256;
-                digit = carry % 58;
-                carry /= 58;
-            }
-            while (carry > 0) {
-                digits.push_back(carry % 58);
-                carry /= 58;
-            }
-        }
-        std::vector<uint8_t> result(leading_zeros, '1');
-        for (const int &digit : std::ranges::reverse_view(digits)) {
-            result.push_back(BASE58_CHARS[digit]);
-        }
-        return result;
+    using Detail::BASE58_ALPHABET;
+
+    size_t Base58::MaxEncodedSize(size_t size) {
+        // log(256) / log(58) ~= 1.366 digits per byte
+        return size + size / 100 * 38 + size % 100 * 38 / 100 + 1;
     }
 
-    std::vector<uint8_t> Base58::Decode(const std::vector<uint8_t> &data) {
-        static const std::vector<int32_t> table = [] {
-            std::vector t(256, -1);
-            constexpr uint8_t BASE58_CHARS[] = "123456789ABCDEFGHJKLMNPQRSTUVWX"
-                                               "YZabcdefghijkmnopqrstuvwxyz";
-            for (int32_t i = 0; i < 58; ++i) {
-                t[BASE58_CHARS[i]] = i;
-            }
-            return t;
-        }();
+    size_t Base58::MaxDecodedSize(size_t size) {
+        // Every leading '1' is a zero byte; other digits carry fewer bits
+        return size;
+    }
 
-        if (data.empty())
-            return {};
+    size_t Base58::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        size_t leading_zeros = 0;
+        while (leading_zeros < in.size() && in[leading_zeros] == 0) {
+            out[leading_zeros++] = BASE58_ALPHABET.chars[0];
+        }
+        return leading_zeros +
+                Detail::RadixEncode(in.subspan(leading_zeros), BASE58_ALPHABET,
+                                    out.data() + leading_zeros);
+    }
 
+    std::optional<size_t> Base58::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
         size_t leading_ones = 0;
-        while (leading_ones < data.size() && data[leading_ones] == '1') {
-            ++leading_ones;
+        while (leading_ones < in.size() &&
+               in[leading_ones] == BASE58_ALPHABET.chars[0]) {
+            out[leading_ones++] = 0x00;
         }
+        const auto size =
+                Detail::RadixDecode(in.subspan(leading_ones), BASE58_ALPHABET,
+                                    out.data() + leading_ones);
+        if (!size)
+            return std::nullopt;
+        return leading_ones + *size;
+    }
 
-        const size_t max_bytes = (data.size() - leading_ones) * 138 / 100 + 1;
-        std::vector<uint8_t> bytes;
-        bytes.reserve(max_bytes);
-
-        for (size_t i = leading_ones; i < data.size(); ++i) {
-            const uint8_t c = data[i];
-            const int32_t pos = table[c];
-            if (pos == -1)
-                return {};
-
-            int32_t carry = pos;
-            for (auto &byte : bytes) {
-                carry += static_cast<int32_t>(byte) * 58;
-                byte = carry % 256;
-                carry /= 256;
-            }
-
-            while (carry > 0) {
-                bytes.push_back(carry % 256);
-                carry /= 256;
-            }
-        }
+    std::vector<uint8_t> Base58::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
 
-        std::vector<uint8_t> result;
-        result.reserve(leading_ones + bytes.size());
-        result.insert(result.end(), leading_ones, 0x00);
-        result.insert(result.end(), bytes.rbegin(), bytes.rend());
-        return result;
+    std::vector<uint8_t> Base58::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base58::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base58::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -26,101 +26,73 @@
  */
 /* clang-format on */
 #include "base62.h"
-#include <algorithm>
+#include "radix.h"
+#include "algorithm/common/byte_buffer.h"
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base62::Encode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE62_CHARS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXY"
-                                           "Zabcdefghijklmnopqrstuvwxyz";
-
-        if (data.empty())
-            return {};
-
-        std::vector<uint8_t> result;
-        result.reserve(
-                static_cast<size_t>(static_cast<double>(data.size()) * 1.37) +
-                3);
-        std::vector<uint32_t> digits(data.begin(), data.end());
-
-        while (!digits.empty()) {
-            uint32_t remainder = 0;
-            std::vector<uint32_t> new_digits;
-            new_digits.reserve(digits.size());
+    using Detail::BASE62_ALPHABET;
 
-            for (const uint32_t num : digits) {
-                const uint64_t val =
-                        static_cast<uint64_t>(remainder) * 256 + num;
-                auto quot = static_cast<uint32_t>(val / 62);
-                remainder = static_cast<uint32_t>(val % 62);
-
-                if (!new_digits.empty() || quot != 0) {
-                    new_digits.push_back(quot);
-                }
-            }
+    size_t Base62::MaxEncodedSize(size_t size) {
+        // log(256) / log(62) ~= 1.344 digits per byte
+        return size + size / 100 * 35 + size % 100 * 35 / 100 + 1;
+    }
 
-            result.push_back(remainder);
-            digits.assign(new_digits.begin(), new_digits.end());
-        }
+    size_t Base62::MaxDecodedSize(size_t size) {
+        // log(62) / log(256) ~= 0.744 bytes per digit
+        return size / 1000 * 745 + size % 1000 * 745 / 1000 + 1;
+    }
 
-        std::ranges::reverse(result);
+    // Base62 has no leading-zero convention: the input is treated as one
+    // big-endian number and zero encodes as "0"
+    size_t Base62::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        const size_t size =
+                Detail::RadixEncode(in, BASE62_ALPHABET, out.data());
+        if (size != 0)
+            return size;
+        out[0] = BASE62_ALPHABET.chars[0];
+        return 1;
+    }
 
-        std::vector<uint8_t> encoded;
-        encoded.reserve(result.size());
-        for (const uint8_t num : result) {
-            encoded.push_back(BASE62_CHARS[num]);
-        }
+    std::optional<size_t> Base62::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        const auto size = Detail::RadixDecode(in, BASE62_ALPHABET, out.data());
+        if (!size)
+            return std::nullopt;
+        if (*size != 0)
+            return size;
+        out[0] = 0x00;
+        return 1;
+    }
 
-        return encoded;
+    std::vector<uint8_t> Base62::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
     }
 
     std::vector<uint8_t> Base62::Decode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE62_CHARS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXY"
-                                           "Zabcdefghijklmnopqrstuvwxyz";
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> table(256, -1);
-        for (int32_t i = 0; i < 62; i++) {
-            table[BASE62_CHARS[i]] = i;
-        }
-        std::vector<uint8_t> result;
-        for (const auto c : data) {
-            const size_t pos = table[c];
-            if (pos == -1) {
-                return {};
-            }
-            const auto num = static_cast<uint32_t>(pos);
-
-            uint32_t carry = num;
-            for (int32_t i = static_cast<int32_t>(result.size()) - 1; i >= 0;
-                 --i) {
-                const uint32_t temp = result[i] * 62 + carry;
-                result[i] = static_cast<uint8_t>(temp % 256);
-                carry = temp / 256;
-            }
-
-            while (carry > 0) {
-                result.insert(result.begin(), carry % 256);
-                carry /= 256;
-            }
-        }
-
-        if (!data.empty() && result.empty()) {
-            result.push_back(0);
-        }
-
-        return result;
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base62::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base62::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -28,6 +28,8 @@
 #ifndef BASE62_H
 #define BASE62_H
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 namespace CryptoToysPP::Algorithm::Base {
@@ -40,6 +42,21 @@ namespace CryptoToysPP::Algorithm::Base {
         static std::string Encode(const std::string &data);
 
         static std::string Decode(const std::string &data);
+
+        // Output sizes for the caller-provided buffers below
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out);
+
+        // Decode into `out` (MaxDecodedSize(in.size()) bytes); returns the
+        // bytes written, or std::nullopt for malformed input
+        static std::optional<size_t> Decode(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out);
     };
 } // namespace CryptoToysPP::Algorithm::Base
 
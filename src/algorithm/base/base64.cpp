@@ -26,222 +26,422 @@
  */
 /* clang-format on */
 #include "base64.h"
-#include <algorithm>
+#include "base64_simd.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/executor.h"
+#include <atomic>
+#include <cstring>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base64::Encode(const uint8_t *data, const size_t len) {
-        if (len <= 0)
-            return {};
-        constexpr uint8_t BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                           "jklmnopqrstuvwxyz0123456789+/";
-        std::vector<uint8_t> encoded;
-        encoded.reserve(4 * ((len + 2) / 3));
-
-        size_t i = 0;
-        while (i < len) {
-            uint32_t triple = 0;
-            int32_t valid_bytes = 0;
-
-            for (int32_t j = 0; j < 3; ++j, ++i) {
-                triple <<= 8;
-                if (i < len) {
-                    triple |= data[i];
-                    valid_bytes++;
+    namespace {
+        using Detail::Base64Alphabet;
+
+        // Scalar groups decoded before the vector kernel is retried, so an
+        // input the kernel keeps rejecting is not rescanned per group
+        constexpr size_t SCALAR_RETRY_GROUPS = 16;
+
+        // Inputs from this size on are split across the shared executor in
+        // chunks of about PARALLEL_GRAIN bytes
+        constexpr size_t PARALLEL_THRESHOLD = 4 * 1024 * 1024;
+        constexpr size_t PARALLEL_GRAIN = 1024 * 1024;
+
+        bool UseParallel(size_t len) {
+            return len >= PARALLEL_THRESHOLD &&
+                    Common::Executor::Shared().ThreadCount() > 1;
+        }
+
+        size_t EncodedSize(size_t len, bool pad) {
+            if (pad)
+                return 4 * ((len + 2) / 3);
+            return len / 3 * 4 + (len % 3 == 0 ? 0 : len % 3 + 1);
+        }
+
+        // Decoded size of `len` characters with the padding already removed
+        size_t DecodedSize(size_t len) {
+            return len / 4 * 3 + (len % 4 == 0 ? 0 : len % 4 - 1);
+        }
+
+        size_t EncodeSerial(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet,
+                            bool pad) {
+            const uint8_t *chars = alphabet.chars;
+            size_t i = Detail::Base64EncodeBulk(data, len, out, alphabet);
+            uint8_t *cursor = out + i / 3 * 4;
+
+            for (; len - i >= 3; i += 3) {
+                const uint32_t triple = (uint32_t{data[i]} << 16) |
+                        (uint32_t{data[i + 1]} << 8) | data[i + 2];
+                *cursor++ = chars[(triple >> 18) & 0x3F];
+                *cursor++ = chars[(triple >> 12) & 0x3F];
+                *cursor++ = chars[(triple >> 6) & 0x3F];
+                *cursor++ = chars[triple & 0x3F];
+            }
+
+            const size_t remaining = len - i;
+            if (remaining > 0) {
+                uint32_t triple = uint32_t{data[i]} << 16;
+                if (remaining == 2)
+                    triple |= uint32_t{data[i + 1]} << 8;
+                *cursor++ = chars[(triple >> 18) & 0x3F];
+                *cursor++ = chars[(triple >> 12) & 0x3F];
+                if (remaining == 2) {
+                    *cursor++ = chars[(triple >> 6) & 0x3F];
+                } else if (pad) {
+                    *cursor++ = '=';
                 }
+                if (pad)
+                    *cursor++ = '=';
             }
+            return static_cast<size_t>(cursor - out);
+        }
 
-            const int32_t sextets = (valid_bytes * 8 + 5) / 6;
-            for (int32_t j = 0; j < 4; ++j) {
-                const uint8_t index = (triple >> (18 - j * 6)) & 0x3F;
-                if (j < sextets) {
-                    encoded.push_back(BASE64_CHARS[index]);
-                } else {
-                    encoded.push_back('=');
+        // Decode `len` characters with the padding already removed into
+        // `out` (DecodedSize(len) bytes). Trailing bits of a partial group
+        // are ignored. Returns false on any character outside the alphabet.
+        bool DecodeSerial(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet) {
+            if (len % 4 == 1)
+                return false;
+
+            const uint8_t *values = alphabet.values;
+            size_t i = 0;
+            while (true) {
+                const size_t consumed =
+                        Detail::Base64DecodeBulk(data + i, len - i, out,
+                                                 alphabet);
+                i += consumed;
+                out += consumed / 4 * 3;
+                if (len - i < 4)
+                    break;
+
+                for (size_t group = 0;
+                     group < SCALAR_RETRY_GROUPS && len - i >= 4;
+                     ++group, i += 4) {
+                    const uint8_t a = values[data[i]];
+                    const uint8_t b = values[data[i + 1]];
+                    const uint8_t c = values[data[i + 2]];
+                    const uint8_t d = values[data[i + 3]];
+                    if (((a | b | c | d) & 0xC0) != 0)
+                        return false;
+                    const uint32_t quad = (uint32_t{a} << 18) |
+                            (uint32_t{b} << 12) | (uint32_t{c} << 6) | d;
+                    *out++ = static_cast<uint8_t>(quad >> 16);
+                    *out++ = static_cast<uint8_t>(quad >> 8);
+                    *out++ = static_cast<uint8_t>(quad);
                 }
             }
+
+            const size_t remaining = len - i;
+            if (remaining == 0)
+                return true;
+            uint32_t quad = 0;
+            for (size_t k = 0; k < remaining; ++k) {
+                const uint8_t value = values[data[i + k]];
+                if ((value & 0xC0) != 0)
+                    return false;
+                quad |= uint32_t{value} << (18 - 6 * k);
+            }
+            *out++ = static_cast<uint8_t>(quad >> 16);
+            if (remaining == 3)
+                *out = static_cast<uint8_t>(quad >> 8);
+            return true;
         }
-        return encoded;
-    }
 
-    std::vector<uint8_t> Base64::Decode(const uint8_t *data, const size_t len) {
-        if (len <= 0 || len % 4 != 0)
-            return {};
+        size_t EncodeInto(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet,
+                          bool pad) {
+            if (!UseParallel(len))
+                return EncodeSerial(data, len, out, alphabet, pad);
+
+            // Whole 3-byte groups encode independently; the tail and its
+            // padding are done afterwards
+            const size_t groups = len / 3;
+            Common::Executor::Shared().ParallelFor(
+                    groups, PARALLEL_GRAIN / 3, [&](size_t begin, size_t end) {
+                        EncodeSerial(data + begin * 3, (end - begin) * 3,
+                                     out + begin * 4, alphabet, false);
+                    });
+            return groups * 4 + EncodeSerial(data + groups * 3, len % 3,
+                                             out + groups * 4, alphabet, pad);
+        }
 
-        constexpr uint8_t BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                           "jklmnopqrstuvwxyz0123456789+/";
+        bool DecodeInto(const uint8_t *data,
+                        size_t len,
+                        uint8_t *out,
+                        const Base64Alphabet &alphabet) {
+            if (!UseParallel(len))
+                return DecodeSerial(data, len, out, alphabet);
+
+            const size_t groups = len / 4;
+            std::atomic<bool> valid{true};
+            Common::Executor::Shared().ParallelFor(
+                    groups, PARALLEL_GRAIN / 4, [&](size_t begin, size_t end) {
+                        if (valid.load(std::memory_order_relaxed) &&
+                            !DecodeSerial(data + begin * 4, (end - begin) * 4,
+                                          out + begin * 3, alphabet))
+                            valid.store(false, std::memory_order_relaxed);
+                    });
+            return valid.load() &&
+                    DecodeSerial(data + groups * 4, len % 4, out + groups * 3,
+                                 alphabet);
+        }
 
-        std::vector decode_table(256, -1);
-        for (int32_t i = 0; i < 64; ++i) {
-            decode_table[BASE64_CHARS[i]] = i;
+        size_t EncodeWith(std::span<const uint8_t> in,
+                          std::span<uint8_t> out,
+                          const Base64Alphabet &alphabet,
+                          bool pad) {
+            Common::RequireCapacity(out, EncodedSize(in.size(), pad));
+            if (in.empty())
+                return 0;
+            return EncodeInto(in.data(), in.size(), out.data(), alphabet,
+                              pad);
         }
-        decode_table['='] = -1;
-
-        std::vector<uint8_t> decoded;
-        decoded.reserve((len * 3) / 4);
-
-        uint32_t buffer = 0;
-        int32_t bits_collected = 0;
-        int32_t padding = 0;
-
-        for (size_t i = 0; i < len; ++i) {
-            const uint8_t c = data[i];
-            if (c == '=') {
-                padding++;
-                if (i < len - 2 || padding > 2)
-                    return {};
-                continue;
-            }
-            if (decode_table[c] == -1)
-                return {};
 
-            buffer = (buffer << 6) | decode_table[c];
-            bits_collected += 6;
+        // `requirePadding`: standard Base64 needs whole 4-character groups
+        // with at most two '=' at the end; URL Base64 makes padding optional
+        std::optional<size_t> DecodeWith(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out,
+                                         const Base64Alphabet &alphabet,
+                                         bool requirePadding) {
+            const uint8_t *data = in.data();
+            const size_t len = in.size();
+            if (len == 0)
+                return 0;
+            if (requirePadding && len % 4 != 0)
+                return std::nullopt;
+
+            size_t padding = 0;
+            while (padding < 2 && padding < len &&
+                   data[len - 1 - padding] == '=')
+                ++padding;
+            if (padding > 0 && len % 4 != 0)
+                return std::nullopt;
+
+            const size_t body = len - padding;
+            const size_t size = DecodedSize(body);
+            Common::RequireCapacity(out, size);
+            if (!DecodeInto(data, body, out.data(), alphabet))
+                return std::nullopt;
+            return size;
+        }
 
-            if (bits_collected >= 8) {
-                decoded.push_back((buffer >> (bits_collected - 8)) & 0xFF);
-                bits_collected -= 8;
-            }
+        const Base64Alphabet &GetAlphabet(Base64::Variant variant) {
+            return variant == Base64::Variant::URL ? Detail::BASE64_URL
+                                                   : Detail::BASE64_STANDARD;
         }
-        if (padding > 0) {
-            const size_t expected_size = (len - padding) * 3 / 4;
-            if (decoded.size() < expected_size)
-                return {};
-            decoded.resize(expected_size);
+
+        template<typename Container>
+        Container EncodeAs(std::span<const uint8_t> in,
+                           const Base64Alphabet &alphabet,
+                           bool pad) {
+            return Common::FillBuffer<Container>(
+                    EncodedSize(in.size(), pad), [&](std::span<uint8_t> out) {
+                        return EncodeWith(in, out, alphabet, pad);
+                    });
+        }
+
+        template<typename Container>
+        Container DecodeAs(std::span<const uint8_t> in,
+                           const Base64Alphabet &alphabet,
+                           bool requirePadding) {
+            return Common::TryFillBuffer<Container>(
+                    DecodedSize(in.size()), [&](std::span<uint8_t> out) {
+                        return DecodeWith(in, out, alphabet, requirePadding);
+                    });
         }
-        return decoded;
+    } // namespace
+
+    size_t Base64::MaxEncodedSize(size_t size) {
+        return EncodedSize(size, true);
     }
 
-    std::vector<uint8_t> Base64::Encode(const std::vector<uint8_t> &data) {
-        return Encode(data.data(), data.size());
+    size_t Base64::MaxDecodedSize(size_t size) {
+        return DecodedSize(size);
     }
 
-    std::vector<uint8_t> Base64::Decode(const std::vector<uint8_t> &data) {
-        return Decode(data.data(), data.size());
+    size_t Base64::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        return EncodeWith(in, out, Detail::BASE64_STANDARD, true);
     }
 
-    std::string Base64::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+    std::optional<size_t> Base64::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        return DecodeWith(in, out, Detail::BASE64_STANDARD, true);
     }
 
-    std::string Base64::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+    size_t Base64::EncodeURL(std::span<const uint8_t> in,
+                             std::span<uint8_t> out) {
+        return EncodeWith(in, out, Detail::BASE64_URL, false);
     }
 
-    std::vector<uint8_t> Base64::EncodeURL(const uint8_t *data,
-                                           const size_t len) {
-        if (len <= 0)
-            return {};
-        constexpr uint8_t BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                           "jklmnopqrstuvwxyz0123456789+/";
-        std::vector<uint8_t> encoded;
-        encoded.reserve(4 * ((len + 2) / 3));
-
-        size_t i = 0;
-        while (i < len) {
-            uint32_t triple = 0;
-            int32_t valid_bytes = 0;
-
-            for (int32_t j = 0; j < 3; ++j, ++i) {
-                triple <<= 8;
-                if (i < len) {
-                    triple |= data[i];
-                    valid_bytes++;
-                }
+    std::optional<size_t> Base64::DecodeURL(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out) {
+        return DecodeWith(in, out, Detail::BASE64_URL, false);
+    }
+
+    Base64::StreamEncoder::StreamEncoder(Variant variant) : variant(variant) {}
+
+    size_t Base64::StreamEncoder::MaxUpdateSize(size_t size) {
+        // Up to 2 pending bytes ahead of the new input
+        return (size + 2) / 3 * 4;
+    }
+
+    size_t Base64::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const Base64Alphabet &alphabet = GetAlphabet(variant);
+        uint8_t *cursor = out.data();
+        if (count != 0) {
+            while (count < 3 && !in.empty()) {
+                group[count++] = in.front();
+                in = in.subspan(1);
             }
+            if (count < 3)
+                return 0;
+            cursor += EncodeSerial(group, 3, cursor, alphabet, false);
+            count = 0;
+        }
+
+        const size_t whole = in.size() / 3 * 3;
+        if (whole != 0)
+            cursor += EncodeInto(in.data(), whole, cursor, alphabet, false);
+        for (const uint8_t byte : in.subspan(whole))
+            group[count++] = byte;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base64::StreamEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const size_t written = EncodeSerial(group, count, out.data(),
+                                            GetAlphabet(variant),
+                                            variant == Variant::STANDARD);
+        count = 0;
+        return written;
+    }
+
+    Base64::StreamDecoder::StreamDecoder(Variant variant) : variant(variant) {}
+
+    size_t Base64::StreamDecoder::MaxUpdateSize(size_t size) {
+        // Up to 3 pending characters ahead of the new input
+        return (size + 3) / 4 * 3;
+    }
+
+    std::optional<size_t>
+    Base64::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const Base64Alphabet &alphabet = GetAlphabet(variant);
+        uint8_t *cursor = out.data();
+        total = (total + in.size()) % 4;
+
+        // Characters up to the first '=' belong to the body
+        size_t body = padding == 0 ? in.size() : 0;
+        if (body != 0) {
+            if (const void *mark = std::memchr(in.data(), '=', body))
+                body = static_cast<size_t>(
+                        static_cast<const uint8_t *>(mark) - in.data());
+        }
+        std::span<const uint8_t> chars = in.first(body);
 
-            const int32_t sextets = (valid_bytes * 8 + 5) / 6;
-            for (int32_t j = 0; j < 4; ++j) {
-                const uint8_t index = (triple >> (18 - j * 6)) & 0x3F;
-                if (j < sextets) {
-                    encoded.push_back(BASE64_CHARS[index]);
-                } else {
-                    encoded.push_back('=');
+        if (count != 0) {
+            while (count < 4 && !chars.empty()) {
+                group[count++] = chars.front();
+                chars = chars.subspan(1);
+            }
+            if (count == 4) {
+                if (!DecodeSerial(group, 4, cursor, alphabet)) {
+                    failed = true;
+                    return std::nullopt;
                 }
+                cursor += 3;
+                count = 0;
             }
         }
 
-        for (auto &c : encoded) {
-            if (c == '+')
-                c = '-';
-            if (c == '/')
-                c = '_';
+        const size_t whole = chars.size() / 4 * 4;
+        if (!DecodeInto(chars.data(), whole, cursor, alphabet)) {
+            failed = true;
+            return std::nullopt;
         }
-        while (!encoded.empty() && encoded.back() == '=')
-            encoded.pop_back();
-
-        return encoded;
+        cursor += whole / 4 * 3;
+        for (const uint8_t c : chars.subspan(whole))
+            group[count++] = c;
+
+        // At most two '=' and nothing after them
+        for (const uint8_t c : in.subspan(body)) {
+            if (c != '=' || padding == 2) {
+                failed = true;
+                return std::nullopt;
+            }
+            ++padding;
+        }
+        return static_cast<size_t>(cursor - out.data());
     }
 
-    std::vector<uint8_t> Base64::DecodeURL(const uint8_t *data,
-                                           const size_t len) {
-        if (len <= 0)
-            return {};
-
-        std::vector modified_data(data, data + len);
-        std::ranges::transform(modified_data, modified_data.begin(),
-                               [](const uint8_t c) -> uint8_t {
-                                   if (c == '-')
-                                       return '+';
-                                   if (c == '_')
-                                       return '/';
-                                   return c;
-                               });
-
-        const size_t padding = (4 - (modified_data.size() % 4)) % 4;
-        modified_data.insert(modified_data.end(), padding, '=');
-
-        constexpr uint8_t BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                           "jklmnopqrstuvwxyz0123456789+/";
-        std::vector decode_table(256, -1);
-        for (int32_t i = 0; i < 64; ++i) {
-            decode_table[BASE64_CHARS[i]] = i;
+    std::optional<size_t>
+    Base64::StreamDecoder::Finish(std::span<uint8_t> out) {
+        bool valid = !failed && count != 1;
+        // Standard Base64 needs whole groups, URL Base64 only when padded
+        if (total != 0 && (variant == Variant::STANDARD || padding != 0))
+            valid = false;
+        size_t written = 0;
+        if (valid && count != 0) {
+            Common::RequireCapacity(out, MAX_FINISH_SIZE);
+            valid = DecodeSerial(group, count, out.data(),
+                                 GetAlphabet(variant));
+            written = DecodedSize(count);
         }
+        *this = StreamDecoder(variant);
+        if (!valid)
+            return std::nullopt;
+        return written;
+    }
 
-        std::vector<uint8_t> decoded;
-        decoded.reserve((modified_data.size() * 3) / 4);
+    std::vector<uint8_t> Base64::Encode(const uint8_t *data, const size_t len) {
+        return EncodeAs<std::vector<uint8_t>>({data, len},
+                                              Detail::BASE64_STANDARD, true);
+    }
 
-        uint32_t buffer = 0;
-        int32_t bits_collected = 0;
-        bool padding_started = false;
+    std::vector<uint8_t> Base64::Decode(const uint8_t *data, const size_t len) {
+        return DecodeAs<std::vector<uint8_t>>({data, len},
+                                              Detail::BASE64_STANDARD, true);
+    }
 
-        for (size_t i = 0; i < modified_data.size(); ++i) {
-            const uint8_t c = modified_data[i];
-            if (c == '=') {
-                if (i < modified_data.size() - padding)
-                    return {};
-                padding_started = true;
-                continue;
-            }
+    std::vector<uint8_t> Base64::Encode(const std::vector<uint8_t> &data) {
+        return Encode(data.data(), data.size());
+    }
 
-            if (decode_table[c] == -1)
-                return {};
-            if (padding_started)
-                return {};
+    std::vector<uint8_t> Base64::Decode(const std::vector<uint8_t> &data) {
+        return Decode(data.data(), data.size());
+    }
 
-            buffer = (buffer << 6) | decode_table[c];
-            bits_collected += 6;
+    std::string Base64::Encode(const std::string &data) {
+        return EncodeAs<std::string>(Common::AsBytes(data),
+                                     Detail::BASE64_STANDARD, true);
+    }
 
-            if (bits_collected >= 8) {
-                decoded.push_back(static_cast<uint8_t>(
-                        (buffer >> (bits_collected - 8)) & 0xFF));
-                bits_collected -= 8;
-            }
-        }
+    std::string Base64::Decode(const std::string &data) {
+        return DecodeAs<std::string>(Common::AsBytes(data),
+                                     Detail::BASE64_STANDARD, true);
+    }
 
-        if (padding > 0) {
-            const size_t expected_size =
-                    (modified_data.size() - padding) * 3 / 4;
-            if (decoded.size() < expected_size)
-                return {};
-            decoded.resize(expected_size);
-        }
+    std::vector<uint8_t> Base64::EncodeURL(const uint8_t *data,
+                                           const size_t len) {
+        return EncodeAs<std::vector<uint8_t>>({data, len}, Detail::BASE64_URL,
+                                              false);
+    }
 
-        return decoded;
+    std::vector<uint8_t> Base64::DecodeURL(const uint8_t *data,
+                                           const size_t len) {
+        return DecodeAs<std::vector<uint8_t>>({data, len}, Detail::BASE64_URL,
+                                              false);
     }
 
     std::vector<uint8_t> Base64::EncodeURL(const std::vector<uint8_t> &data) {
@@ -253,16 +453,12 @@ namespace CryptoToysPP::Algorithm::Base {
     }
 
     std::string Base64::EncodeURL(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = EncodeURL(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return EncodeAs<std::string>(Common::AsBytes(data), Detail::BASE64_URL,
+                                     false);
     }
 
     std::string Base64::DecodeURL(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = DecodeURL(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return DecodeAs<std::string>(Common::AsBytes(data), Detail::BASE64_URL,
+                                     false);
     }
 } // namespace CryptoToysPP::Algorithm::Base
@@ -30,6 +30,9 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <optional>
+#include <span>
+#include "algorithm/common/stream_codec.h"
 namespace CryptoToysPP::Algorithm::Base {
     class Base64 {
     public:
@@ -56,6 +59,85 @@ namespace CryptoToysPP::Algorithm::Base {
         static std::string EncodeURL(const std::string &data);
 
         static std::string DecodeURL(const std::string &data);
+
+        // Output sizes for the caller-provided buffers below; they cover
+        // both the padded and the URL variant
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out);
+
+        // Decode into `out` (MaxDecodedSize(in.size()) bytes); returns the
+        // bytes written, or std::nullopt for malformed input
+        static std::optional<size_t> Decode(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out);
+
+        static size_t EncodeURL(std::span<const uint8_t> in,
+                                std::span<uint8_t> out);
+
+        static std::optional<size_t> DecodeURL(std::span<const uint8_t> in,
+                                               std::span<uint8_t> out);
+
+        // Selects Encode/Decode or EncodeURL/DecodeURL for the streams
+        enum class Variant { STANDARD, URL };
+
+        // Incremental encoding: feeding the input in pieces gives the same
+        // output as a single Encode. Update needs MaxUpdateSize(in.size())
+        // bytes of room and Finish MAX_FINISH_SIZE.
+        class StreamEncoder : public Common::StreamEncoderBase<StreamEncoder> {
+        public:
+            using StreamEncoderBase::Finish;
+            using StreamEncoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 4;
+
+            explicit StreamEncoder(Variant variant = Variant::STANDARD);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            size_t Update(std::span<const uint8_t> in,
+                          std::span<uint8_t> out);
+
+            // Encode (and pad) the partial group and reset for a new stream
+            size_t Finish(std::span<uint8_t> out);
+
+        private:
+            Variant variant;
+            uint8_t group[3] = {}; // pending input bytes
+            size_t count = 0;      // number of pending bytes, below 3
+        };
+
+        // Incremental decoding with the same rules as Decode/DecodeURL;
+        // after malformed input every call returns std::nullopt until
+        // Finish resets the decoder
+        class StreamDecoder : public Common::StreamDecoderBase<StreamDecoder> {
+        public:
+            using StreamDecoderBase::Finish;
+            using StreamDecoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 2;
+
+            explicit StreamDecoder(Variant variant = Variant::STANDARD);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            std::optional<size_t> Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out);
+
+            std::optional<size_t> Finish(std::span<uint8_t> out);
+
+        private:
+            Variant variant;
+            uint8_t group[4] = {}; // pending characters
+            size_t count = 0;      // number of pending characters, below 4
+            size_t total = 0;      // characters seen, modulo 4
+            size_t padding = 0;    // '=' seen; only more may follow
+            bool failed = false;
+        };
     };
 } // namespace CryptoToysPP::Algorithm::Base
 #endif // BASE64_H
@@ -0,0 +1,505 @@
+/* clang-format off */
+/*
+ * @file base64_simd.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "base64_simd.h"
+#include "algorithm/common/cpu.h"
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#elif defined(CRYPTOTOYSPP_NEON)
+#include <arm_neon.h>
+#endif
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    namespace {
+        using EncodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const Base64Alphabet &);
+        using DecodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const Base64Alphabet &);
+
+        size_t EncodeNone(const uint8_t *, size_t, uint8_t *,
+                          const Base64Alphabet &) {
+            return 0;
+        }
+
+        size_t DecodeNone(const uint8_t *, size_t, uint8_t *,
+                          const Base64Alphabet &) {
+            return 0;
+        }
+
+#if defined(CRYPTOTOYSPP_X86)
+        // The 128/256-bit kernels follow Mula & Lemire, "Faster Base64
+        // Encoding and Decoding Using AVX2 Instructions" (2018). Indices
+        // are turned into characters by adding a per-range offset, so only
+        // the entries for values 62 and 63 depend on the alphabet.
+
+        // ---- SSE4.1: 12 bytes <-> 16 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i EncodeReshuffle(__m128i in) {
+            // Per 3-byte group [a b c] build the 32-bit lane [b a c b], then
+            // move each sextet into its own byte
+            in = _mm_shuffle_epi8(in,
+                                  _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6,
+                                                8, 7, 10, 9, 11, 10));
+            const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+            const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+            const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            return _mm_or_si128(t1, t3);
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i EncodeTranslate(__m128i indices, __m128i shiftLut) {
+            // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+            __m128i slot = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+            slot = _mm_or_si128(slot,
+                                _mm_and_si128(less, _mm_set1_epi8(13)));
+            return _mm_add_epi8(indices, _mm_shuffle_epi8(shiftLut, slot));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i EncodeShiftLut128(const Base64Alphabet &alphabet) {
+            const auto c62 = static_cast<char>(alphabet.chars[62] - 62);
+            const auto c63 = static_cast<char>(alphabet.chars[63] - 63);
+            return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                 '0' - 52, '0' - 52, '0' - 52, c62, c63, 'A',
+                                 0, 0);
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const Base64Alphabet &alphabet) {
+            const __m128i shiftLut = EncodeShiftLut128(alphabet);
+            size_t i = 0;
+            // Each load reads 16 bytes but consumes 12
+            for (; len - i >= 16; i += 12, out += 16) {
+                const __m128i in = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                 EncodeTranslate(EncodeReshuffle(in),
+                                                 shiftLut));
+            }
+            return i;
+        }
+
+        // Character -> sextet by range; `valid` flags alphabet characters.
+        // Bytes >= 0x80 compare as negative and fall in no range.
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeTranslate(__m128i c,
+                                       __m128i char62,
+                                       __m128i char63,
+                                       __m128i &valid) {
+            const __m128i upper =
+                    _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), c));
+            const __m128i lower =
+                    _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), c));
+            const __m128i digit =
+                    _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), c));
+            const __m128i is62 = _mm_cmpeq_epi8(c, char62);
+            const __m128i is63 = _mm_cmpeq_epi8(c, char63);
+
+            __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+            offset = _mm_or_si128(
+                    offset, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+            offset = _mm_or_si128(
+                    offset, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+            offset = _mm_or_si128(
+                    offset,
+                    _mm_and_si128(is62, _mm_sub_epi8(_mm_set1_epi8(62),
+                                                     char62)));
+            offset = _mm_or_si128(
+                    offset,
+                    _mm_and_si128(is63, _mm_sub_epi8(_mm_set1_epi8(63),
+                                                     char63)));
+
+            valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                 _mm_or_si128(digit,
+                                              _mm_or_si128(is62, is63)));
+            return _mm_add_epi8(c, offset);
+        }
+
+        // Pack four sextets per 32-bit lane into 3 bytes at the low end
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeReshuffle(__m128i values) {
+            const __m128i pairs =
+                    _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i lanes =
+                    _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+            return _mm_shuffle_epi8(lanes,
+                                    _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                                  14, 13, 12, -1, -1, -1,
+                                                  -1));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const Base64Alphabet &alphabet) {
+            const __m128i char62 =
+                    _mm_set1_epi8(static_cast<char>(alphabet.chars[62]));
+            const __m128i char63 =
+                    _mm_set1_epi8(static_cast<char>(alphabet.chars[63]));
+            size_t i = 0;
+            // Stores are 16 bytes wide for 12 decoded; keep 24 characters
+            // ahead so they stay inside the caller's buffer
+            for (; len - i >= 24; i += 16, out += 12) {
+                const __m128i c = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i));
+                __m128i valid;
+                const __m128i values =
+                        DecodeTranslate(c, char62, char63, valid);
+                if (_mm_movemask_epi8(valid) != 0xFFFF)
+                    break;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                 DecodeReshuffle(values));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 24 bytes <-> 32 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t EncodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet) {
+            const auto c62 = static_cast<char>(alphabet.chars[62] - 62);
+            const auto c63 = static_cast<char>(alphabet.chars[63] - 63);
+            const __m256i shiftLut = _mm256_setr_epi8(
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, c62, c63, 'A', 0, 0, 'a' - 26, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, c62, c63, 'A', 0,
+                    0);
+            const __m256i shuffle = _mm256_setr_epi8(
+                    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0,
+                    2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+            size_t i = 0;
+            // The upper lane loads 16 bytes at offset 12
+            for (; len - i >= 28; i += 24, out += 32) {
+                const __m128i lo = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i));
+                const __m128i hi = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i + 12));
+                __m256i in = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(lo), hi, 1);
+                in = _mm256_shuffle_epi8(in, shuffle);
+                const __m256i t0 =
+                        _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+                const __m256i t1 = _mm256_mulhi_epu16(
+                        t0, _mm256_set1_epi32(0x04000040));
+                const __m256i t2 =
+                        _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+                const __m256i t3 = _mm256_mullo_epi16(
+                        t2, _mm256_set1_epi32(0x01000010));
+                const __m256i indices = _mm256_or_si256(t1, t3);
+
+                __m256i slot =
+                        _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+                const __m256i less =
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+                slot = _mm256_or_si256(
+                        slot, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+                const __m256i chars = _mm256_add_epi8(
+                        indices, _mm256_shuffle_epi8(shiftLut, slot));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), chars);
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t DecodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet) {
+            const __m256i char62 =
+                    _mm256_set1_epi8(static_cast<char>(alphabet.chars[62]));
+            const __m256i char63 =
+                    _mm256_set1_epi8(static_cast<char>(alphabet.chars[63]));
+            const __m256i offset62 =
+                    _mm256_sub_epi8(_mm256_set1_epi8(62), char62);
+            const __m256i offset63 =
+                    _mm256_sub_epi8(_mm256_set1_epi8(63), char63);
+            const __m256i shuffle = _mm256_setr_epi8(
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2,
+                    1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+            const __m256i gather = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+            size_t i = 0;
+            // 32-byte stores for 24 decoded bytes; keep 48 characters ahead
+            for (; len - i >= 48; i += 32, out += 24) {
+                const __m256i c = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i *>(data + i));
+                const __m256i upper = _mm256_and_si256(
+                        _mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)),
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+                const __m256i lower = _mm256_and_si256(
+                        _mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)),
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+                const __m256i digit = _mm256_and_si256(
+                        _mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+                        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+                const __m256i is62 = _mm256_cmpeq_epi8(c, char62);
+                const __m256i is63 = _mm256_cmpeq_epi8(c, char63);
+                const __m256i valid = _mm256_or_si256(
+                        _mm256_or_si256(upper, lower),
+                        _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+                if (_mm256_movemask_epi8(valid) != -1)
+                    break;
+
+                __m256i offset =
+                        _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+                offset = _mm256_or_si256(
+                        offset,
+                        _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+                offset = _mm256_or_si256(
+                        offset,
+                        _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+                offset = _mm256_or_si256(offset,
+                                         _mm256_and_si256(is62, offset62));
+                offset = _mm256_or_si256(offset,
+                                         _mm256_and_si256(is63, offset63));
+                const __m256i values = _mm256_add_epi8(c, offset);
+
+                const __m256i pairs = _mm256_maddubs_epi16(
+                        values, _mm256_set1_epi32(0x01400140));
+                __m256i lanes = _mm256_madd_epi16(
+                        pairs, _mm256_set1_epi32(0x00011000));
+                lanes = _mm256_shuffle_epi8(lanes, shuffle);
+                lanes = _mm256_permutevar8x32_epi32(lanes, gather);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), lanes);
+            }
+            return i;
+        }
+
+        // ---- AVX-512 VBMI: 48 bytes <-> 64 characters per step ----
+        // Byte permutes index the alphabet directly, so any alphabet works
+        // without per-range fix-ups (Mula, "AVX512VBMI base64", 2016).
+
+        constexpr uint64_t MASK_48 = (uint64_t{1} << 48) - 1;
+
+        CRYPTOTOYSPP_TARGET("avx512f,avx512bw,avx512vl,avx512vbmi")
+        size_t EncodeAvx512(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet) {
+            const __m512i lookup = _mm512_loadu_si512(alphabet.chars);
+            // [a b c] -> 32-bit lane [b a c b], as in the SSE kernel
+            const __m512i shuffle = _mm512_setr_epi32(
+                    0x01020001, 0x04050304, 0x07080607, 0x0a0b090a,
+                    0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+                    0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122,
+                    0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e);
+            // Bit offsets of the four sextets within each lane pair
+            const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+
+            size_t i = 0;
+            for (; len - i >= 48; i += 48, out += 64) {
+                __m512i in = _mm512_maskz_loadu_epi8(MASK_48, data + i);
+                in = _mm512_permutexvar_epi8(shuffle, in);
+                const __m512i indices =
+                        _mm512_multishift_epi64_epi8(shifts, in);
+                _mm512_storeu_si512(out,
+                                    _mm512_permutexvar_epi8(indices, lookup));
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx512f,avx512bw,avx512vl,avx512vbmi")
+        size_t DecodeAvx512(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet) {
+            // 128-entry table; bytes >= 0x80 are caught by their sign bit
+            const __m512i lookupLo = _mm512_loadu_si512(alphabet.values);
+            const __m512i lookupHi = _mm512_loadu_si512(alphabet.values + 64);
+            alignas(64) static constexpr uint8_t PACK[64] = {
+                    2,  1,  0,  6,  5,  4,  10, 9,  8,  14, 13, 12, 18,
+                    17, 16, 22, 21, 20, 26, 25, 24, 30, 29, 28, 34, 33,
+                    32, 38, 37, 36, 42, 41, 40, 46, 45, 44, 50, 49, 48,
+                    54, 53, 52, 58, 57, 56, 62, 61, 60};
+            const __m512i pack = _mm512_load_si512(PACK);
+
+            size_t i = 0;
+            for (; len - i >= 64; i += 64, out += 48) {
+                const __m512i c = _mm512_loadu_si512(data + i);
+                const __m512i values =
+                        _mm512_permutex2var_epi8(lookupLo, c, lookupHi);
+                if (_mm512_movepi8_mask(_mm512_or_si512(values, c)) != 0)
+                    break;
+                const __m512i pairs = _mm512_maddubs_epi16(
+                        values, _mm512_set1_epi32(0x01400140));
+                const __m512i lanes = _mm512_madd_epi16(
+                        pairs, _mm512_set1_epi32(0x00011000));
+                _mm512_mask_storeu_epi8(
+                        out, MASK_48, _mm512_permutexvar_epi8(pack, lanes));
+            }
+            return i;
+        }
+#endif
+
+#if defined(CRYPTOTOYSPP_NEON)
+        // ---- NEON: 48 bytes <-> 64 characters per step ----
+        // De-interleaving loads/stores split the groups into planes, and
+        // the 64-entry alphabet fits one four-register table lookup.
+
+        size_t EncodeNeon(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet) {
+            uint8x16x4_t lookup;
+            for (int k = 0; k < 4; ++k)
+                lookup.val[k] = vld1q_u8(alphabet.chars + 16 * k);
+            const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+            size_t i = 0;
+            for (; len - i >= 48; i += 48, out += 64) {
+                const uint8x16x3_t in = vld3q_u8(data + i);
+                uint8x16x4_t chars;
+                chars.val[0] = vshrq_n_u8(in.val[0], 2);
+                chars.val[1] =
+                        vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+                                          vshrq_n_u8(in.val[1], 4)),
+                                 mask);
+                chars.val[2] =
+                        vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+                                          vshrq_n_u8(in.val[2], 6)),
+                                 mask);
+                chars.val[3] = vandq_u8(in.val[2], mask);
+                for (int k = 0; k < 4; ++k)
+                    chars.val[k] = vqtbl4q_u8(lookup, chars.val[k]);
+                vst4q_u8(out, chars);
+            }
+            return i;
+        }
+
+        size_t DecodeNeon(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base64Alphabet &alphabet) {
+            uint8x16x4_t lookupLo;
+            uint8x16x4_t lookupHi;
+            for (int k = 0; k < 4; ++k) {
+                lookupLo.val[k] = vld1q_u8(alphabet.values + 16 * k);
+                lookupHi.val[k] = vld1q_u8(alphabet.values + 64 + 16 * k);
+            }
+            const uint8x16_t offset = vdupq_n_u8(64);
+
+            size_t i = 0;
+            for (; len - i >= 64; i += 64, out += 48) {
+                const uint8x16x4_t c = vld4q_u8(data + i);
+                uint8x16x4_t values;
+                uint8x16_t error = vdupq_n_u8(0);
+                for (int k = 0; k < 4; ++k) {
+                    // Indices 0..63 hit the low table, 64..127 the high one;
+                    // invalid entries and bytes >= 0x80 have bit 7 set
+                    values.val[k] =
+                            vqtbx4q_u8(vqtbl4q_u8(lookupLo, c.val[k]),
+                                       lookupHi,
+                                       vsubq_u8(c.val[k], offset));
+                    error = vorrq_u8(error,
+                                     vorrq_u8(values.val[k], c.val[k]));
+                }
+                if ((vmaxvq_u8(error) & 0x80) != 0)
+                    break;
+
+                uint8x16x3_t bytes;
+                bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2),
+                                        vshrq_n_u8(values.val[1], 4));
+                bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4),
+                                        vshrq_n_u8(values.val[2], 2));
+                bytes.val[2] =
+                        vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+                vst3q_u8(out, bytes);
+            }
+            return i;
+        }
+#endif
+
+        EncodeKernel SelectEncodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx512vbmi)
+                return EncodeAvx512;
+            if (features.avx2)
+                return EncodeAvx2;
+            if (features.sse41)
+                return EncodeSse41;
+#elif defined(CRYPTOTOYSPP_NEON)
+            if (features.neon)
+                return EncodeNeon;
+#endif
+            (void) features;
+            return EncodeNone;
+        }
+
+        DecodeKernel SelectDecodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx512vbmi)
+                return DecodeAvx512;
+            if (features.avx2)
+                return DecodeAvx2;
+            if (features.sse41)
+                return DecodeSse41;
+#elif defined(CRYPTOTOYSPP_NEON)
+            if (features.neon)
+                return DecodeNeon;
+#endif
+            (void) features;
+            return DecodeNone;
+        }
+    } // namespace
+
+    size_t Base64EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet) {
+        static const EncodeKernel kernel = SelectEncodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+
+    size_t Base64DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet) {
+        static const DecodeKernel kernel = SelectDecodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+} // namespace CryptoToysPP::Algorithm::Base::Detail
@@ -0,0 +1,95 @@
+/* clang-format off */
+/*
+ * @file base64_simd.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BASE64_SIMD_H
+#define BASE64_SIMD_H
+#include <cstddef>
+#include <cstdint>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    inline constexpr uint8_t BASE64_INVALID = 0xFF;
+
+    // Alphabet shared by the scalar and vector kernels. All supported
+    // variants use A-Z, a-z, 0-9 for values 0..61 and differ in the two
+    // remaining characters.
+    struct Base64Alphabet {
+        uint8_t chars[64];   // value -> character
+        uint8_t values[256]; // character -> value or BASE64_INVALID
+    };
+
+    // `extra62`/`extra63` are also accepted when decoding (0 for none)
+    constexpr Base64Alphabet MakeBase64Alphabet(char char62,
+                                                char char63,
+                                                char extra62 = 0,
+                                                char extra63 = 0) {
+        Base64Alphabet alphabet{};
+        for (int i = 0; i < 26; ++i) {
+            alphabet.chars[i] = static_cast<uint8_t>('A' + i);
+            alphabet.chars[26 + i] = static_cast<uint8_t>('a' + i);
+        }
+        for (int i = 0; i < 10; ++i)
+            alphabet.chars[52 + i] = static_cast<uint8_t>('0' + i);
+        alphabet.chars[62] = static_cast<uint8_t>(char62);
+        alphabet.chars[63] = static_cast<uint8_t>(char63);
+
+        for (auto &value : alphabet.values)
+            value = BASE64_INVALID;
+        for (int i = 0; i < 64; ++i)
+            alphabet.values[alphabet.chars[i]] = static_cast<uint8_t>(i);
+        if (extra62 != 0)
+            alphabet.values[static_cast<uint8_t>(extra62)] = 62;
+        if (extra63 != 0)
+            alphabet.values[static_cast<uint8_t>(extra63)] = 63;
+        return alphabet;
+    }
+
+    inline constexpr Base64Alphabet BASE64_STANDARD =
+            MakeBase64Alphabet('+', '/');
+
+    // URL decoding also accepts the standard characters
+    inline constexpr Base64Alphabet BASE64_URL =
+            MakeBase64Alphabet('-', '_', '+', '/');
+
+    // Encode as many whole 3-byte groups from the front of `data` as the
+    // active vector kernel handles; the caller finishes the remainder.
+    // Writes 4 characters per group to `out` and returns the number of
+    // input bytes consumed (a multiple of 3, possibly 0).
+    size_t Base64EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet);
+
+    // Decode whole 4-character groups from the front of `data`, stopping
+    // before the first vector block holding anything but the alphabet's
+    // 64 characters. `out` must have room for len / 4 * 3 bytes. Returns
+    // the number of characters consumed (a multiple of 4, possibly 0).
+    size_t Base64DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base64Alphabet &alphabet);
+} // namespace CryptoToysPP::Algorithm::Base::Detail
+
+#endif // BASE64_SIMD_H
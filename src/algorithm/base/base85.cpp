@@ -26,111 +26,483 @@
  */
 /* clang-format on */
 #include "base85.h"
+#include "base85_simd.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
+#include <cstring>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base85::Encode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE85_CHARS[] = "!\"#$%&'()*+,-./0123456789:;<=>?@"
-                                           "ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
-                                           "abcdefghijklmnopqrstu";
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> encoded;
-        const size_t padding = (4 - (data.size() % 4)) % 4;
-        std::vector padded(data);
-        padded.insert(padded.end(), padding, 0);
-
-        for (size_t i = 0; i < padded.size(); i += 4) {
-            uint32_t chunk = (padded[i] << 24) | (padded[i + 1] << 16) |
-                    (padded[i + 2] << 8) | padded[i + 3];
-            if (chunk == 0) {
-                encoded.push_back('z');
-                continue;
-            }
+    namespace {
+        using Detail::Base85Alphabet;
+        using Detail::BASE85_ASCII;
+        using Detail::BASE85_Z85;
+
+        constexpr uint8_t ASCII85_PREFIX[] = {'<', '~'};
+        constexpr uint8_t ASCII85_SUFFIX[] = {'~', '>'};
+
+        // Groups decoded in scalar code after the vector kernel stops,
+        // before it is tried again
+        constexpr size_t SCALAR_RETRY_GROUPS = 8;
 
-            uint8_t buf[5];
-            for (int32_t j = 4; j >= 0; --j) {
-                buf[j] = BASE85_CHARS[chunk % 85];
-                chunk /= 85;
+        // std::isspace in the "C" locale without the per-call overhead
+        constexpr bool IsSpace(uint8_t c) {
+            return c == ' ' || (c >= '\t' && c <= '\r');
+        }
+
+        // Bytes produced by a well-formed input; the zero shortcut
+        // expands to four
+        size_t DecodedSize(std::span<const uint8_t> data,
+                           const Base85Alphabet &alphabet) {
+            size_t zeros = 0, chars = 0;
+            for (const uint8_t c : data) {
+                if (alphabet.zero != 0 && c == alphabet.zero)
+                    ++zeros;
+                else if (!IsSpace(c))
+                    ++chars;
             }
-            encoded.insert(encoded.end(), buf, buf + 5);
+            return zeros * 4 + chars / 5 * 4 +
+                    (chars % 5 == 0 ? 0 : chars % 5 - 1);
         }
-        if (padding)
-            encoded.resize(encoded.size() - padding);
-        return encoded;
-    }
 
-    std::vector<uint8_t> Base85::Decode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE85_CHARS[] = "!\"#$%&'()*+,-./0123456789:;<=>?@"
-                                           "ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
-                                           "abcdefghijklmnopqrstu";
-        if (data.empty())
-            return {};
-        std::vector table(256, -1);
-        for (int32_t i = 0; i < 85; ++i) {
-            table[BASE85_CHARS[i]] = i;
-        }
-        std::vector<uint8_t> decoded;
-        std::vector<uint8_t> buffer;
-
-        for (auto c : data) {
-            if (std::isspace(c))
-                continue;
-            if (c == 'z') {
-                if (!buffer.empty())
-                    return {};
-                decoded.insert(decoded.end(), 4, 0x00);
-                continue;
+        bool DecodeGroup(const uint8_t *group,
+                         uint32_t &chunk,
+                         const Base85Alphabet &alphabet) {
+            chunk = 0;
+            for (int32_t j = 0; j < 5; ++j) {
+                const uint8_t pos = alphabet.values[group[j]];
+                if (pos == Detail::BASE85_INVALID)
+                    return false;
+                chunk = chunk * 85 + pos;
             }
+            return true;
+        }
+
+        uint8_t *EncodeBody(std::span<const uint8_t> in,
+                            uint8_t *cursor,
+                            const Base85Alphabet &alphabet) {
+            const uint8_t *data = in.data();
+            const size_t len = in.size();
+            size_t i = Detail::Base85EncodeBulk(data, len, cursor, alphabet);
 
-            buffer.push_back(c);
-            if (buffer.size() == 5) {
+            for (; i < len; i += 4) {
+                const size_t valid = std::min<size_t>(4, len - i);
                 uint32_t chunk = 0;
-                for (int32_t j = 0; j < 5; ++j) {
-                    const auto pos = table[buffer[j]];
-                    if (pos == -1)
-                        return {};
-                    chunk = chunk * 85 + pos;
+                for (size_t j = 0; j < 4; ++j)
+                    chunk = (chunk << 8) | (j < valid ? data[i + j] : 0);
+
+                // The shortcut is only for complete groups; a zero tail
+                // would otherwise be cut from the shortcut itself
+                if (chunk == 0 && valid == 4 && alphabet.zero != 0) {
+                    *cursor++ = alphabet.zero;
+                    continue;
                 }
 
-                decoded.push_back((chunk >> 24) & 0xFF);
-                decoded.push_back((chunk >> 16) & 0xFF);
-                decoded.push_back((chunk >> 8) & 0xFF);
-                decoded.push_back(chunk & 0xFF);
-                buffer.clear();
+                uint8_t buf[5];
+                for (int32_t j = 4; j >= 0; --j) {
+                    buf[j] = alphabet.chars[chunk % 85];
+                    chunk /= 85;
+                }
+                cursor = std::copy_n(buf, valid + 1, cursor);
             }
+            return cursor;
         }
 
-        if (!buffer.empty()) {
-            const size_t padding = 5 - buffer.size();
-            for (size_t i = 0; i < padding; ++i)
-                buffer.push_back('u');
-
+        // Decode `len` characters, carrying an incomplete group in
+        // `buffer`/`buffered` from and to the caller. Advances `cursor`
+        // past the output; returns false on malformed input.
+        bool DecodeChars(const uint8_t *data,
+                         size_t len,
+                         uint8_t *&cursor,
+                         uint8_t *buffer,
+                         size_t &buffered,
+                         const Base85Alphabet &alphabet) {
             uint32_t chunk = 0;
-            for (int32_t j = 0; j < 5; ++j) {
-                const auto pos = table[buffer[j]];
-                if (pos == -1)
-                    return {};
-                chunk = chunk * 85 + pos;
+            size_t i = 0;
+            while (true) {
+                if (buffered == 0) {
+                    const size_t consumed = Detail::Base85DecodeBulk(
+                            data + i, len - i, cursor, alphabet);
+                    i += consumed;
+                    cursor += consumed / 5 * 4;
+                }
+
+                // Whitespace, the zero shortcut and invalid characters
+                // are handled here; leave on a group boundary
+                size_t groups = 0;
+                for (; i < len && (buffered != 0 ||
+                                   groups < SCALAR_RETRY_GROUPS);
+                     ++i) {
+                    const uint8_t c = data[i];
+                    if (IsSpace(c))
+                        continue;
+                    if (alphabet.zero != 0 && c == alphabet.zero) {
+                        if (buffered != 0)
+                            return false;
+                        cursor = std::fill_n(cursor, 4, 0x00);
+                        ++groups;
+                        continue;
+                    }
+
+                    buffer[buffered++] = c;
+                    if (buffered == 5) {
+                        if (!DecodeGroup(buffer, chunk, alphabet))
+                            return false;
+                        *cursor++ = (chunk >> 24) & 0xFF;
+                        *cursor++ = (chunk >> 16) & 0xFF;
+                        *cursor++ = (chunk >> 8) & 0xFF;
+                        *cursor++ = chunk & 0xFF;
+                        buffered = 0;
+                        ++groups;
+                    }
+                }
+                if (i == len)
+                    return true;
             }
+        }
 
-            const size_t valid_bytes = 4 - padding;
+        // Decode the shortened final group, if any
+        bool DecodeTail(uint8_t *&cursor,
+                        uint8_t *buffer,
+                        size_t buffered,
+                        const Base85Alphabet &alphabet) {
+            if (buffered == 0)
+                return true;
+            uint32_t chunk = 0;
+            const size_t valid_bytes = buffered - 1;
+            std::fill(buffer + buffered, buffer + 5, alphabet.chars[84]);
+            if (!DecodeGroup(buffer, chunk, alphabet))
+                return false;
             for (size_t j = 0; j < valid_bytes; ++j) {
-                decoded.push_back((chunk >> (24 - j * 8)) & 0xFF);
+                *cursor++ = (chunk >> (24 - j * 8)) & 0xFF;
             }
+            return true;
+        }
+
+        std::optional<size_t> DecodeBody(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out,
+                                         const Base85Alphabet &alphabet) {
+            Common::RequireCapacity(out, DecodedSize(in, alphabet));
+            uint8_t *cursor = out.data();
+            uint8_t buffer[5];
+            size_t buffered = 0;
+            if (!DecodeChars(in.data(), in.size(), cursor, buffer, buffered,
+                             alphabet) ||
+                !DecodeTail(cursor, buffer, buffered, alphabet))
+                return std::nullopt;
+            return static_cast<size_t>(cursor - out.data());
         }
-        return decoded;
+
+        const Base85Alphabet &GetAlphabet(Base85::Variant variant) {
+            return variant == Base85::Variant::Z85 ? BASE85_Z85
+                                                   : BASE85_ASCII;
+        }
+
+        // Drop surrounding whitespace and the optional "<~" / "~>"
+        std::span<const uint8_t> StripAscii85(std::span<const uint8_t> data) {
+            while (!data.empty() && IsSpace(data.front()))
+                data = data.subspan(1);
+            while (!data.empty() && IsSpace(data.back()))
+                data = data.first(data.size() - 1);
+            if (data.size() >= 2 &&
+                std::equal(data.begin(), data.begin() + 2, ASCII85_PREFIX))
+                data = data.subspan(2);
+            if (data.size() >= 2 &&
+                std::equal(data.end() - 2, data.end(), ASCII85_SUFFIX))
+                data = data.first(data.size() - 2);
+            return data;
+        }
+
+        std::span<const uint8_t> AsSpan(const std::vector<uint8_t> &data) {
+            return data;
+        }
+
+        std::span<const uint8_t> AsSpan(const std::string &data) {
+            return Common::AsBytes(data);
+        }
+
+        // Allocating wrappers around the span-based variants
+        template<typename Container, typename Encoder>
+        Container EncodeAll(const Container &data, Encoder &&encode) {
+            return Common::FillBuffer<Container>(
+                    Base85::MaxEncodedSize(data.size()),
+                    [&](std::span<uint8_t> out) {
+                        return encode(AsSpan(data), out);
+                    });
+        }
+
+        template<typename Container, typename Decoder>
+        Container DecodeAll(const Container &data,
+                            size_t size,
+                            Decoder &&decode) {
+            return Common::TryFillBuffer<Container>(
+                    size, [&](std::span<uint8_t> out) {
+                        return decode(AsSpan(data), out);
+                    });
+        }
+    } // namespace
+
+    size_t Base85::MaxEncodedSize(size_t size) {
+        // Ascii85 adds its two delimiters
+        return size / 4 * 5 + (size % 4 == 0 ? 0 : size % 4 + 1) +
+                sizeof(ASCII85_PREFIX) + sizeof(ASCII85_SUFFIX);
+    }
+
+    size_t Base85::MaxDecodedSize(size_t size) {
+        // Every 'z' stands for four zero bytes
+        return size * 4;
+    }
+
+    size_t Base85::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        return static_cast<size_t>(EncodeBody(in, out.data(), BASE85_ASCII) -
+                                   out.data());
+    }
+
+    std::optional<size_t> Base85::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        return DecodeBody(in, out, BASE85_ASCII);
+    }
+
+    size_t Base85::EncodeZ85(std::span<const uint8_t> in,
+                             std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        return static_cast<size_t>(EncodeBody(in, out.data(), BASE85_Z85) -
+                                   out.data());
+    }
+
+    std::optional<size_t> Base85::DecodeZ85(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out) {
+        return DecodeBody(in, out, BASE85_Z85);
+    }
+
+    size_t Base85::EncodeAscii85(std::span<const uint8_t> in,
+                                 std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        uint8_t *cursor = std::ranges::copy(ASCII85_PREFIX, out.data()).out;
+        cursor = EncodeBody(in, cursor, BASE85_ASCII);
+        cursor = std::ranges::copy(ASCII85_SUFFIX, cursor).out;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t> Base85::DecodeAscii85(std::span<const uint8_t> in,
+                                                std::span<uint8_t> out) {
+        return DecodeBody(StripAscii85(in), out, BASE85_ASCII);
+    }
+
+    Base85::StreamEncoder::StreamEncoder(Variant variant) : variant(variant) {}
+
+    size_t Base85::StreamEncoder::MaxUpdateSize(size_t size) {
+        // Up to 3 pending bytes ahead of the new input, and "<~"
+        return (size + 3) / 4 * 5 + sizeof(ASCII85_PREFIX);
+    }
+
+    size_t Base85::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const Base85Alphabet &alphabet = GetAlphabet(variant);
+        uint8_t *cursor = out.data();
+        if (variant == Variant::ASCII85 && !opened) {
+            cursor = std::ranges::copy(ASCII85_PREFIX, cursor).out;
+            opened = true;
+        }
+        if (count != 0) {
+            while (count < 4 && !in.empty()) {
+                group[count++] = in.front();
+                in = in.subspan(1);
+            }
+            if (count < 4)
+                return static_cast<size_t>(cursor - out.data());
+            cursor = EncodeBody(group, cursor, alphabet);
+            count = 0;
+        }
+
+        const size_t whole = in.size() / 4 * 4;
+        cursor = EncodeBody(in.first(whole), cursor, alphabet);
+        for (const uint8_t byte : in.subspan(whole))
+            group[count++] = byte;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base85::StreamEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        uint8_t *cursor = out.data();
+        if (variant == Variant::ASCII85 && !opened)
+            cursor = std::ranges::copy(ASCII85_PREFIX, cursor).out;
+        cursor = EncodeBody({group, count}, cursor, GetAlphabet(variant));
+        if (variant == Variant::ASCII85)
+            cursor = std::ranges::copy(ASCII85_SUFFIX, cursor).out;
+        count = 0;
+        opened = false;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    Base85::StreamDecoder::StreamDecoder(Variant variant)
+        : variant(variant),
+          stage(variant == Variant::ASCII85 ? Stage::START : Stage::BODY) {}
+
+    size_t Base85::StreamDecoder::MaxUpdateSize(size_t size) {
+        // Every character may be a zero shortcut or complete a group
+        return size * 4;
+    }
+
+    std::optional<size_t>
+    Base85::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const Base85Alphabet &alphabet = GetAlphabet(variant);
+        uint8_t *cursor = out.data();
+        auto fail = [this] {
+            failed = true;
+            return std::nullopt;
+        };
+
+        while (!in.empty()) {
+            const uint8_t c = in.front();
+            switch (stage) {
+                case Stage::START: // leading whitespace, then maybe "<~"
+                    if (c == ASCII85_PREFIX[0])
+                        stage = Stage::OPENING;
+                    else if (!IsSpace(c))
+                        stage = Stage::BODY;
+                    if (stage != Stage::BODY)
+                        in = in.subspan(1);
+                    continue;
+                case Stage::OPENING: // a '<' that may start the body
+                    stage = Stage::BODY;
+                    if (c == ASCII85_PREFIX[1]) {
+                        in = in.subspan(1);
+                    } else if (!DecodeChars(ASCII85_PREFIX, 1, cursor, group,
+                                            count, alphabet)) {
+                        return fail();
+                    }
+                    continue;
+                case Stage::BODY: {
+                    // Only Ascii85 ends at a '~', which is outside its
+                    // alphabet
+                    size_t body = in.size();
+                    if (variant == Variant::ASCII85) {
+                        if (const void *mark = std::memchr(
+                                    in.data(), ASCII85_SUFFIX[0], in.size()))
+                            body = static_cast<size_t>(
+                                    static_cast<const uint8_t *>(mark) -
+                                    in.data());
+                    }
+                    if (!DecodeChars(in.data(), body, cursor, group, count,
+                                     alphabet))
+                        return fail();
+                    in = in.subspan(body);
+                    if (!in.empty()) {
+                        stage = Stage::CLOSING;
+                        in = in.subspan(1);
+                    }
+                    continue;
+                }
+                case Stage::CLOSING:
+                    if (c != ASCII85_SUFFIX[1])
+                        return fail();
+                    stage = Stage::CLOSED;
+                    in = in.subspan(1);
+                    continue;
+                case Stage::CLOSED: // only trailing whitespace
+                    if (!IsSpace(c))
+                        return fail();
+                    in = in.subspan(1);
+                    continue;
+            }
+        }
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t>
+    Base85::StreamDecoder::Finish(std::span<uint8_t> out) {
+        const Base85Alphabet &alphabet = GetAlphabet(variant);
+        uint8_t *cursor = out.data();
+        bool valid = !failed && stage != Stage::CLOSING;
+        if (valid) {
+            Common::RequireCapacity(out, MAX_FINISH_SIZE);
+            if (stage == Stage::OPENING)
+                valid = DecodeChars(ASCII85_PREFIX, 1, cursor, group, count,
+                                    alphabet);
+            valid = valid && DecodeTail(cursor, group, count, alphabet);
+        }
+        *this = StreamDecoder(variant);
+        if (!valid)
+            return std::nullopt;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::vector<uint8_t> Base85::Encode(const std::vector<uint8_t> &data) {
+        return EncodeAll(data, [](auto in, auto out) {
+            return Encode(in, out);
+        });
+    }
+
+    std::vector<uint8_t> Base85::Decode(const std::vector<uint8_t> &data) {
+        return DecodeAll(data, DecodedSize(data, BASE85_ASCII),
+                         [](auto in, auto out) { return Decode(in, out); });
     }
 
     std::string Base85::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return EncodeAll(data, [](auto in, auto out) {
+            return Encode(in, out);
+        });
     }
 
     std::string Base85::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return DecodeAll(data, DecodedSize(AsSpan(data), BASE85_ASCII),
+                         [](auto in, auto out) { return Decode(in, out); });
+    }
+
+    std::vector<uint8_t> Base85::EncodeZ85(const std::vector<uint8_t> &data) {
+        return EncodeAll(data, [](auto in, auto out) {
+            return EncodeZ85(in, out);
+        });
+    }
+
+    std::vector<uint8_t> Base85::DecodeZ85(const std::vector<uint8_t> &data) {
+        return DecodeAll(data, DecodedSize(data, BASE85_Z85),
+                         [](auto in, auto out) { return DecodeZ85(in, out); });
+    }
+
+    std::string Base85::EncodeZ85(const std::string &data) {
+        return EncodeAll(data, [](auto in, auto out) {
+            return EncodeZ85(in, out);
+        });
+    }
+
+    std::string Base85::DecodeZ85(const std::string &data) {
+        return DecodeAll(data, DecodedSize(AsSpan(data), BASE85_Z85),
+                         [](auto in, auto out) { return DecodeZ85(in, out); });
+    }
+
+    std::vector<uint8_t>
+    Base85::EncodeAscii85(const std::vector<uint8_t> &data) {
+        return EncodeAll(data, [](auto in, auto out) {
+            return EncodeAscii85(in, out);
+        });
+    }
+
+    std::vector<uint8_t>
+    Base85::DecodeAscii85(const std::vector<uint8_t> &data) {
+        return DecodeAll(data, DecodedSize(StripAscii85(data), BASE85_ASCII),
+                         [](auto in, auto out) {
+                             return DecodeAscii85(in, out);
+                         });
+    }
+
+    std::string Base85::EncodeAscii85(const std::string &data) {
+        return EncodeAll(data, [](auto in, auto out) {
+            return EncodeAscii85(in, out);
+        });
+    }
+
+    std::string Base85::DecodeAscii85(const std::string &data) {
+        return DecodeAll(data,
+                         DecodedSize(StripAscii85(AsSpan(data)), BASE85_ASCII),
+                         [](auto in, auto out) {
+                             return DecodeAscii85(in, out);
+                         });
     }
 } // namespace CryptoToysPP::Algorithm::Base
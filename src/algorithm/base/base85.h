@@ -28,9 +28,17 @@
 #ifndef BASE85_H
 #define BASE85_H
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <vector>
 #include <string>
+#include "algorithm/common/stream_codec.h"
 namespace CryptoToysPP::Algorithm::Base {
+    // Base85 uses the Ascii85 alphabet and 'z' shortcut without
+    // delimiters. Z85 is the ZeroMQ variant; inputs whose length is not a
+    // multiple of 4 get a shortened final group, as with Base85. Ascii85
+    // is the Adobe form wrapped in "<~" and "~>", which are optional when
+    // decoding.
     class Base85 {
     public:
         static std::vector<uint8_t> Encode(const std::vector<uint8_t> &data);
@@ -40,6 +48,116 @@ namespace CryptoToysPP::Algorithm::Base {
         static std::string Encode(const std::string &data);
 
         static std::string Decode(const std::string &data);
+
+        static std::vector<uint8_t> EncodeZ85(const std::vector<uint8_t> &data);
+
+        static std::vector<uint8_t> DecodeZ85(const std::vector<uint8_t> &data);
+
+        static std::string EncodeZ85(const std::string &data);
+
+        static std::string DecodeZ85(const std::string &data);
+
+        static std::vector<uint8_t>
+        EncodeAscii85(const std::vector<uint8_t> &data);
+
+        static std::vector<uint8_t>
+        DecodeAscii85(const std::vector<uint8_t> &data);
+
+        static std::string EncodeAscii85(const std::string &data);
+
+        static std::string DecodeAscii85(const std::string &data);
+
+        // Output sizes for the caller-provided buffers below; they cover
+        // all three variants
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out);
+
+        // Decode into `out`; MaxDecodedSize(in.size()) bytes are always
+        // enough, though only the exact decoded size is required. Returns
+        // the bytes written, or std::nullopt for malformed input
+        static std::optional<size_t> Decode(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out);
+
+        static size_t EncodeZ85(std::span<const uint8_t> in,
+                                std::span<uint8_t> out);
+
+        static std::optional<size_t> DecodeZ85(std::span<const uint8_t> in,
+                                               std::span<uint8_t> out);
+
+        static size_t EncodeAscii85(std::span<const uint8_t> in,
+                                    std::span<uint8_t> out);
+
+        static std::optional<size_t>
+        DecodeAscii85(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+        // Selects which of the three variants a stream uses
+        enum class Variant { BASE85, Z85, ASCII85 };
+
+        // Incremental encoding: feeding the input in pieces gives the same
+        // output as a single Encode. Update needs MaxUpdateSize(in.size())
+        // bytes of room and Finish MAX_FINISH_SIZE.
+        class StreamEncoder : public Common::StreamEncoderBase<StreamEncoder> {
+        public:
+            using StreamEncoderBase::Finish;
+            using StreamEncoderBase::Update;
+
+            // Delimiters and a shortened final group
+            static constexpr size_t MAX_FINISH_SIZE = 8;
+
+            explicit StreamEncoder(Variant variant = Variant::BASE85);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            size_t Update(std::span<const uint8_t> in,
+                          std::span<uint8_t> out);
+
+            // Encode the partial group, close Ascii85's "~>" and reset for
+            // a new stream
+            size_t Finish(std::span<uint8_t> out);
+
+        private:
+            Variant variant;
+            uint8_t group[4] = {}; // pending input bytes
+            size_t count = 0;      // number of pending bytes, below 4
+            bool opened = false;   // Ascii85's "<~" written
+        };
+
+        // Incremental decoding with the same rules as the one-shot
+        // variants; after malformed input every call returns std::nullopt
+        // until Finish resets the decoder
+        class StreamDecoder : public Common::StreamDecoderBase<StreamDecoder> {
+        public:
+            using StreamDecoderBase::Finish;
+            using StreamDecoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 3;
+
+            explicit StreamDecoder(Variant variant = Variant::BASE85);
+
+            static size_t MaxUpdateSize(size_t size);
+
+            std::optional<size_t> Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out);
+
+            std::optional<size_t> Finish(std::span<uint8_t> out);
+
+        private:
+            // Position relative to Ascii85's optional delimiters; the
+            // other variants stay in BODY
+            enum class Stage { START, OPENING, BODY, CLOSING, CLOSED };
+
+            Variant variant;
+            Stage stage;
+            uint8_t group[5] = {}; // characters of the incomplete group
+            size_t count = 0;      // number of pending characters, below 5
+            bool failed = false;
+        };
     };
 } // namespace CryptoToysPP::Algorithm::Base
 
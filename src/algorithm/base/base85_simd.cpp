@@ -0,0 +1,452 @@
+/* clang-format off */
+/*
+ * @file base85_simd.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "base85_simd.h"
+#include "algorithm/common/cpu.h"
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#endif
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    namespace {
+        using EncodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *&,
+                                        const Base85Alphabet &);
+        using DecodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const Base85Alphabet &);
+
+        size_t EncodeNone(const uint8_t *, size_t, uint8_t *&,
+                          const Base85Alphabet &) {
+            return 0;
+        }
+
+        size_t DecodeNone(const uint8_t *, size_t, uint8_t *,
+                          const Base85Alphabet &) {
+            return 0;
+        }
+
+        // Digits of scattered alphabets (Z85) are looked up after the
+        // vector step; contiguous ones get the offset added in-register
+        inline void TranslateDigits(uint8_t *digits,
+                                    size_t count,
+                                    const Base85Alphabet &alphabet) {
+            if (alphabet.offset != 0)
+                return;
+            for (size_t i = 0; i < count; ++i)
+                digits[i] = alphabet.chars[digits[i]];
+        }
+
+        // Copy five characters per group, replacing the groups flagged in
+        // `zeros` by the shortcut character
+        inline uint8_t *CompactGroups(const uint8_t *chars,
+                                      size_t groups,
+                                      uint32_t zeros,
+                                      uint8_t *out,
+                                      uint8_t zero) {
+            for (size_t g = 0; g < groups; ++g, chars += 5) {
+                if (zeros & (1u << g)) {
+                    *out++ = zero;
+                    continue;
+                }
+                for (size_t j = 0; j < 5; ++j)
+                    *out++ = chars[j];
+            }
+            return out;
+        }
+
+#if defined(CRYPTOTOYSPP_X86)
+        // Every 32-bit lane holds one group. Division by 85 is a multiply
+        // by the reciprocal: x / 85 == (x * 0xC0C0C0C1) >> 38 for all
+        // 32-bit x. The five digits are then interleaved into 20
+        // characters per four groups with byte shuffles, written as two
+        // overlapping 16-byte stores (positions 0..15 and 4..19).
+
+        // ---- SSE4.1: 16 bytes <-> 20 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i ByteSwap32(__m128i v) {
+            return _mm_shuffle_epi8(v,
+                                    _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11,
+                                                  10, 9, 8, 15, 14, 13, 12));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i Div85(__m128i v, __m128i &remainder) {
+            const __m128i magic = _mm_set1_epi32(static_cast<int>(0xC0C0C0C1));
+            const __m128i even = _mm_srli_epi64(_mm_mul_epu32(v, magic), 38);
+            const __m128i odd = _mm_srli_epi64(
+                    _mm_mul_epu32(_mm_srli_epi64(v, 32), magic), 38);
+            const __m128i q = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+            remainder = _mm_sub_epi32(
+                    v, _mm_mullo_epi32(q, _mm_set1_epi32(85)));
+            return q;
+        }
+
+        // Digits d0..d3 (most significant first) as the bytes of each lane
+        // in `high`, d4 in the low byte of each lane in `low`
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline void EncodeDigits(__m128i words, __m128i &high, __m128i &low) {
+            __m128i d1, d2, d3;
+            __m128i x = Div85(words, low);
+            x = Div85(x, d3);
+            x = Div85(x, d2);
+            const __m128i d0 = Div85(x, d1);
+            high = _mm_or_si128(
+                    _mm_or_si128(d0, _mm_slli_epi32(d1, 8)),
+                    _mm_or_si128(_mm_slli_epi32(d2, 16),
+                                 _mm_slli_epi32(d3, 24)));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline void InterleaveDigits(__m128i high,
+                                     __m128i low,
+                                     __m128i offset,
+                                     __m128i &first,
+                                     __m128i &second) {
+            first = _mm_or_si128(
+                    _mm_shuffle_epi8(high,
+                                     _mm_setr_epi8(0, 1, 2, 3, -1, 4, 5, 6, 7,
+                                                   -1, 8, 9, 10, 11, -1, 12)),
+                    _mm_shuffle_epi8(low,
+                                     _mm_setr_epi8(-1, -1, -1, -1, 0, -1, -1,
+                                                   -1, -1, 4, -1, -1, -1, -1,
+                                                   8, -1)));
+            second = _mm_or_si128(
+                    _mm_shuffle_epi8(high,
+                                     _mm_setr_epi8(-1, 4, 5, 6, 7, -1, 8, 9,
+                                                   10, 11, -1, 12, 13, 14, 15,
+                                                   -1)),
+                    _mm_shuffle_epi8(low,
+                                     _mm_setr_epi8(0, -1, -1, -1, -1, 4, -1,
+                                                   -1, -1, -1, 8, -1, -1, -1,
+                                                   -1, 12)));
+            first = _mm_add_epi8(first, offset);
+            second = _mm_add_epi8(second, offset);
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *&out,
+                           const Base85Alphabet &alphabet) {
+            const __m128i offset = _mm_set1_epi8(
+                    static_cast<char>(alphabet.offset));
+            uint8_t scratch[20];
+            size_t i = 0;
+            for (; len - i >= 16; i += 16) {
+                const __m128i words = ByteSwap32(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(data + i)));
+                const uint32_t zeros = alphabet.zero == 0
+                        ? 0
+                        : static_cast<uint32_t>(_mm_movemask_ps(
+                                  _mm_castsi128_ps(_mm_cmpeq_epi32(
+                                          words, _mm_setzero_si128()))));
+
+                __m128i high, low, first, second;
+                EncodeDigits(words, high, low);
+                InterleaveDigits(high, low, offset, first, second);
+
+                uint8_t *target = zeros == 0 ? out : scratch;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target), first);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 4),
+                                 second);
+                TranslateDigits(target, 20, alphabet);
+                out = zeros == 0
+                        ? out + 20
+                        : CompactGroups(scratch, 4, zeros, out, alphabet.zero);
+            }
+            return i;
+        }
+
+        // Digits of four groups (positions 0..15 and 4..19) to their
+        // big-endian words: (d0 * 85 + d1) * 85^2 + (d2 * 85 + d3) with
+        // two multiply-add steps, then * 85 + d4 modulo 2^32 like the
+        // scalar decoder
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeDigits(__m128i first, __m128i second) {
+            const __m128i high = _mm_or_si128(
+                    _mm_shuffle_epi8(first,
+                                     _mm_setr_epi8(0, 1, 2, 3, 5, 6, 7, 8, 10,
+                                                   11, 12, 13, -1, -1, -1,
+                                                   -1)),
+                    _mm_shuffle_epi8(second,
+                                     _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1,
+                                                   -1, -1, -1, -1, -1, 11, 12,
+                                                   13, 14)));
+            const __m128i low = _mm_or_si128(
+                    _mm_shuffle_epi8(first,
+                                     _mm_setr_epi8(4, -1, -1, -1, 9, -1, -1,
+                                                   -1, 14, -1, -1, -1, -1, -1,
+                                                   -1, -1)),
+                    _mm_shuffle_epi8(second,
+                                     _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1,
+                                                   -1, -1, -1, -1, -1, 15, -1,
+                                                   -1, -1)));
+            const __m128i pairs =
+                    _mm_maddubs_epi16(high, _mm_set1_epi16(0x0155));
+            const __m128i quads =
+                    _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011C39));
+            return ByteSwap32(_mm_add_epi32(
+                    _mm_mullo_epi32(quads, _mm_set1_epi32(85)), low));
+        }
+
+        // Characters at `chars` (positions 0..15 and 4..19) to digits;
+        // false if any of them is outside the alphabet
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline bool LoadDigits(const uint8_t *chars,
+                               const Base85Alphabet &alphabet,
+                               __m128i &first,
+                               __m128i &second) {
+            if (alphabet.offset == 0) {
+                uint8_t digits[20];
+                uint8_t invalid = 0;
+                for (size_t j = 0; j < 20; ++j) {
+                    digits[j] = alphabet.values[chars[j]];
+                    invalid |= digits[j];
+                }
+                if (invalid & 0x80)
+                    return false;
+                first = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(digits));
+                second = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(digits + 4));
+                return true;
+            }
+            const __m128i offset = _mm_set1_epi8(
+                    static_cast<char>(alphabet.offset));
+            const __m128i top = _mm_set1_epi8(84);
+            first = _mm_sub_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(chars)),
+                    offset);
+            second = _mm_sub_epi8(_mm_loadu_si128(
+                                          reinterpret_cast<const __m128i *>(
+                                                  chars + 4)),
+                                  offset);
+            const __m128i valid = _mm_and_si128(
+                    _mm_cmpeq_epi8(_mm_min_epu8(first, top), first),
+                    _mm_cmpeq_epi8(_mm_min_epu8(second, top), second));
+            return _mm_movemask_epi8(valid) == 0xFFFF;
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const Base85Alphabet &alphabet) {
+            size_t i = 0;
+            for (; len - i >= 20; i += 20, out += 16) {
+                __m128i first, second;
+                if (!LoadDigits(data + i, alphabet, first, second))
+                    break;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                 DecodeDigits(first, second));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 32 bytes <-> 40 characters per step ----
+        // Same steps on both 128-bit lanes, four groups each
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        inline __m256i Broadcast(__m128i v) {
+            return _mm256_broadcastsi128_si256(v);
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        inline __m256i Div85(__m256i v, __m256i &remainder) {
+            const __m256i magic =
+                    _mm256_set1_epi32(static_cast<int>(0xC0C0C0C1));
+            const __m256i even =
+                    _mm256_srli_epi64(_mm256_mul_epu32(v, magic), 38);
+            const __m256i odd = _mm256_srli_epi64(
+                    _mm256_mul_epu32(_mm256_srli_epi64(v, 32), magic), 38);
+            const __m256i q =
+                    _mm256_or_si256(even, _mm256_slli_epi64(odd, 32));
+            remainder = _mm256_sub_epi32(
+                    v, _mm256_mullo_epi32(q, _mm256_set1_epi32(85)));
+            return q;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t EncodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *&out,
+                          const Base85Alphabet &alphabet) {
+            const __m256i swap = Broadcast(_mm_setr_epi8(
+                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+            const __m256i highFirst = Broadcast(_mm_setr_epi8(
+                    0, 1, 2, 3, -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12));
+            const __m256i lowFirst = Broadcast(_mm_setr_epi8(
+                    -1, -1, -1, -1, 0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8,
+                    -1));
+            const __m256i highSecond = Broadcast(_mm_setr_epi8(
+                    -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13, 14, 15,
+                    -1));
+            const __m256i lowSecond = Broadcast(_mm_setr_epi8(
+                    0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1, -1, -1, -1,
+                    12));
+            const __m256i offset =
+                    _mm256_set1_epi8(static_cast<char>(alphabet.offset));
+            uint8_t scratch[40];
+            size_t i = 0;
+            for (; len - i >= 32; i += 32) {
+                const __m256i words = _mm256_shuffle_epi8(
+                        _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(data + i)),
+                        swap);
+                const uint32_t zeros = alphabet.zero == 0
+                        ? 0
+                        : static_cast<uint32_t>(_mm256_movemask_ps(
+                                  _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                                          words, _mm256_setzero_si256()))));
+
+                __m256i low, d1, d2, d3;
+                __m256i x = Div85(words, low);
+                x = Div85(x, d3);
+                x = Div85(x, d2);
+                const __m256i d0 = Div85(x, d1);
+                const __m256i high = _mm256_or_si256(
+                        _mm256_or_si256(d0, _mm256_slli_epi32(d1, 8)),
+                        _mm256_or_si256(_mm256_slli_epi32(d2, 16),
+                                        _mm256_slli_epi32(d3, 24)));
+                const __m256i first = _mm256_add_epi8(
+                        _mm256_or_si256(_mm256_shuffle_epi8(high, highFirst),
+                                        _mm256_shuffle_epi8(low, lowFirst)),
+                        offset);
+                const __m256i second = _mm256_add_epi8(
+                        _mm256_or_si256(_mm256_shuffle_epi8(high, highSecond),
+                                        _mm256_shuffle_epi8(low, lowSecond)),
+                        offset);
+
+                uint8_t *target = zeros == 0 ? out : scratch;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target),
+                                 _mm256_castsi256_si128(first));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 4),
+                                 _mm256_castsi256_si128(second));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 20),
+                                 _mm256_extracti128_si256(first, 1));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 24),
+                                 _mm256_extracti128_si256(second, 1));
+                TranslateDigits(target, 40, alphabet);
+                out = zeros == 0
+                        ? out + 40
+                        : CompactGroups(scratch, 8, zeros, out, alphabet.zero);
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t DecodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const Base85Alphabet &alphabet) {
+            const __m256i highFirst = Broadcast(_mm_setr_epi8(
+                    0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, -1, -1, -1, -1));
+            const __m256i highSecond = Broadcast(_mm_setr_epi8(
+                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12,
+                    13, 14));
+            const __m256i lowFirst = Broadcast(_mm_setr_epi8(
+                    4, -1, -1, -1, 9, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1,
+                    -1));
+            const __m256i lowSecond = Broadcast(_mm_setr_epi8(
+                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1,
+                    -1, -1));
+            const __m256i swap = Broadcast(_mm_setr_epi8(
+                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+            size_t i = 0;
+            for (; len - i >= 40; i += 40, out += 32) {
+                __m128i first0, second0, first1, second1;
+                if (!LoadDigits(data + i, alphabet, first0, second0) ||
+                    !LoadDigits(data + i + 20, alphabet, first1, second1))
+                    break;
+                const __m256i first = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(first0), first1, 1);
+                const __m256i second = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(second0), second1, 1);
+
+                const __m256i high = _mm256_or_si256(
+                        _mm256_shuffle_epi8(first, highFirst),
+                        _mm256_shuffle_epi8(second, highSecond));
+                const __m256i low = _mm256_or_si256(
+                        _mm256_shuffle_epi8(first, lowFirst),
+                        _mm256_shuffle_epi8(second, lowSecond));
+                const __m256i pairs = _mm256_maddubs_epi16(
+                        high, _mm256_set1_epi16(0x0155));
+                const __m256i quads = _mm256_madd_epi16(
+                        pairs, _mm256_set1_epi32(0x00011C39));
+                const __m256i words = _mm256_add_epi32(
+                        _mm256_mullo_epi32(quads, _mm256_set1_epi32(85)), low);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                                    _mm256_shuffle_epi8(words, swap));
+            }
+            return i;
+        }
+#endif
+
+        EncodeKernel SelectEncodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return EncodeAvx2;
+            if (features.sse41)
+                return EncodeSse41;
+#endif
+            (void) features;
+            return EncodeNone;
+        }
+
+        DecodeKernel SelectDecodeKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx2)
+                return DecodeAvx2;
+            if (features.sse41)
+                return DecodeSse41;
+#endif
+            (void) features;
+            return DecodeNone;
+        }
+    } // namespace
+
+    size_t Base85EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *&out,
+                            const Base85Alphabet &alphabet) {
+        static const EncodeKernel kernel = SelectEncodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+
+    size_t Base85DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base85Alphabet &alphabet) {
+        static const DecodeKernel kernel = SelectDecodeKernel();
+        return kernel(data, len, out, alphabet);
+    }
+} // namespace CryptoToysPP::Algorithm::Base::Detail
@@ -0,0 +1,93 @@
+/* clang-format off */
+/*
+ * @file base85_simd.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BASE85_SIMD_H
+#define BASE85_SIMD_H
+#include <cstddef>
+#include <cstdint>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    inline constexpr uint8_t BASE85_INVALID = 0xFF;
+
+    // Alphabet shared by the scalar and vector kernels. Each group of four
+    // bytes is a big-endian number written as five base-85 digits.
+    struct Base85Alphabet {
+        uint8_t chars[85];   // value -> character
+        uint8_t values[256]; // character -> value or BASE85_INVALID
+        uint8_t offset;      // chars[i] == offset + i, or 0 if scattered
+        uint8_t zero;        // shortcut for an all-zero group, 0 for none
+    };
+
+    constexpr Base85Alphabet MakeBase85Alphabet(const char *chars,
+                                                char zero) {
+        Base85Alphabet alphabet{};
+        for (auto &value : alphabet.values)
+            value = BASE85_INVALID;
+        alphabet.offset = static_cast<uint8_t>(chars[0]);
+        for (int i = 0; i < 85; ++i) {
+            alphabet.chars[i] = static_cast<uint8_t>(chars[i]);
+            alphabet.values[alphabet.chars[i]] = static_cast<uint8_t>(i);
+            if (alphabet.chars[i] != alphabet.offset + i)
+                alphabet.offset = 0;
+        }
+        alphabet.zero = static_cast<uint8_t>(zero);
+        return alphabet;
+    }
+
+    // '!'..'u' with the 'z' shortcut, used by Base85 and Adobe Ascii85
+    inline constexpr Base85Alphabet BASE85_ASCII = MakeBase85Alphabet(
+            "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "[\\]^_`abcdefghijklmnopqrstu",
+            'z');
+
+    // ZeroMQ RFC 32, no shortcut
+    inline constexpr Base85Alphabet BASE85_Z85 = MakeBase85Alphabet(
+            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            ".-:+=^!/*?&<>()[]{}@%$#",
+            0);
+
+    // Encode as many whole 4-byte groups from the front of `data` as the
+    // active vector kernel handles; the caller finishes the remainder.
+    // Advances `out` past the characters written (five per group, or the
+    // zero shortcut) and returns the number of input bytes consumed (a
+    // multiple of 4, possibly 0).
+    size_t Base85EncodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *&out,
+                            const Base85Alphabet &alphabet);
+
+    // Decode whole 5-character groups from the front of `data`, stopping
+    // before the first vector block holding anything but the alphabet's
+    // 85 characters (whitespace and the zero shortcut included). `out`
+    // must have room for len / 5 * 4 bytes. Returns the number of
+    // characters consumed (a multiple of 5, possibly 0).
+    size_t Base85DecodeBulk(const uint8_t *data,
+                            size_t len,
+                            uint8_t *out,
+                            const Base85Alphabet &alphabet);
+} // namespace CryptoToysPP::Algorithm::Base::Detail
+
+#endif // BASE85_SIMD_H
@@ -26,106 +26,209 @@
  */
 /* clang-format on */
 #include "base91.h"
+#include "algorithm/common/byte_buffer.h"
+#include <array>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base91::Encode(const std::vector<uint8_t> &data) {
+    namespace {
         constexpr uint8_t BASE91_CHARS[] =
                 "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                 "abcdefghijklmnopqrstuvwxyz"
                 "0123456789!#$%&()*+,./:;<=>?@[]^_`{|}~\"";
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> encoded;
-        encoded.reserve(data.size());
-        uint32_t b = 0;
-        int32_t n = 0;
-        for (const auto byte : data) {
-            b |= static_cast<uint32_t>(byte) << n;
-            n += 8;
-
-            while (n >= 13) {
-                uint32_t v = b & 0x1FFF;
-                if (v > 88) {
-                    b >>= 13;
-                    n -= 13;
-                } else {
-                    v = b & 0x3FFF;
-                    b >>= 14;
-                    n -= 14;
+        constexpr int8_t INVALID = -1;
+
+        constexpr auto BASE91_TABLE = [] {
+            std::array<int8_t, 256> table{};
+            table.fill(INVALID);
+            for (int8_t i = 0; i < 91; ++i) {
+                table[BASE91_CHARS[i]] = i;
+            }
+            return table;
+        }();
+
+        // Encode `in` into `cursor`, carrying the bit accumulator `b` with
+        // `n` pending bits from and to the caller
+        uint8_t *EncodeBytes(std::span<const uint8_t> in,
+                             uint8_t *cursor,
+                             uint32_t &b,
+                             int32_t &n) {
+            for (const auto byte : in) {
+                b |= static_cast<uint32_t>(byte) << n;
+                n += 8;
+
+                // A 14-bit group needs more than 13 buffered bits; at
+                // exactly 13 wait for the next byte (or the tail below)
+                if (n > 13) {
+                    uint32_t v = b & 0x1FFF;
+                    if (v > 88) {
+                        b >>= 13;
+                        n -= 13;
+                    } else {
+                        v = b & 0x3FFF;
+                        b >>= 14;
+                        n -= 14;
+                    }
+                    *cursor++ = BASE91_CHARS[v % 91];
+                    *cursor++ = BASE91_CHARS[v / 91];
                 }
-                encoded.push_back(BASE91_CHARS[v % 91]);
-                encoded.push_back(BASE91_CHARS[v / 91]);
             }
+            return cursor;
         }
 
-        if (n > 0) {
-            encoded.push_back(BASE91_CHARS[b % 91]);
-            if (n > 7 || b >= 91) {
-                encoded.push_back(BASE91_CHARS[b / 91]);
+        uint8_t *EncodeTail(uint8_t *cursor, uint32_t b, int32_t n) {
+            if (n > 0) {
+                *cursor++ = BASE91_CHARS[b % 91];
+                if (n > 7 || b >= 91) {
+                    *cursor++ = BASE91_CHARS[b / 91];
+                }
             }
+            return cursor;
         }
 
-        return encoded;
-    }
+        // Characters outside the alphabet are skipped. `value` holds the
+        // first character of an incomplete pair, or -1.
+        uint8_t *DecodeChars(std::span<const uint8_t> in,
+                             uint8_t *cursor,
+                             uint32_t &buffer,
+                             int32_t &bits_count,
+                             int32_t &value) {
+            for (const auto c : in) {
+                const int32_t idx = BASE91_TABLE[c];
+                if (idx == INVALID)
+                    continue;
 
-    std::vector<uint8_t> Base91::Decode(const std::vector<uint8_t> &data) {
-        constexpr uint8_t BASE91_CHARS[] =
-                "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                "abcdefghijklmnopqrstuvwxyz"
-                "0123456789!#$%&()*+,./:;<=>?@[]^_`{|}~\"";
-        if (data.empty())
-            return {};
+                if (value < 0) {
+                    value = idx;
+                } else {
+                    value += idx * 91;
+                    buffer |= value << bits_count;
+                    bits_count += (value & 0x1FFF) > 88 ? 13 : 14;
+
+                    while (bits_count >= 8) {
+                        *cursor++ = static_cast<uint8_t>(buffer & 0xFF);
+                        buffer >>= 8;
+                        bits_count -= 8;
+                    }
+                    value = -1;
+                }
+            }
+            return cursor;
+        }
 
-        std::vector reverse_table(256, -1);
-        for (int32_t i = 0; i < 91; ++i) {
-            reverse_table[BASE91_CHARS[i]] = i;
+        uint8_t *DecodeTail(uint8_t *cursor,
+                            uint32_t buffer,
+                            int32_t bits_count,
+                            int32_t value) {
+            if (value != -1) {
+                *cursor++ = static_cast<uint8_t>(
+                        (buffer | (value << bits_count)) & 0xFF);
+            }
+            return cursor;
         }
+    } // namespace
+
+    size_t Base91::MaxEncodedSize(size_t size) {
+        // Two characters per 13 bits or more, plus a final pair
+        return size / 13 * 16 + size % 13 * 8 / 13 * 2 + 2;
+    }
+
+    size_t Base91::MaxDecodedSize(size_t size) {
+        // At most 14 bits per pair, plus a final byte
+        return size / 2 * 7 / 4 + 1;
+    }
 
-        std::vector<uint8_t> decoded;
-        decoded.reserve(data.size() * 3 / 4);
+    size_t Base91::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        uint32_t b = 0;
+        int32_t n = 0;
+        uint8_t *cursor = EncodeBytes(in, out.data(), b, n);
+        cursor = EncodeTail(cursor, b, n);
+        return static_cast<size_t>(cursor - out.data());
+    }
 
+    // Characters outside the alphabet are skipped, so decoding never fails
+    std::optional<size_t> Base91::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
         uint32_t buffer = 0;
         int32_t bits_count = 0;
         int32_t value = -1;
+        uint8_t *cursor =
+                DecodeChars(in, out.data(), buffer, bits_count, value);
+        cursor = DecodeTail(cursor, buffer, bits_count, value);
+        return static_cast<size_t>(cursor - out.data());
+    }
 
-        for (const auto c : data) {
-            const int32_t idx = reverse_table[c];
-            if (idx == -1)
-                continue;
-
-            if (value < 0) {
-                value = idx;
-            } else {
-                value += idx * 91;
-                buffer |= value << bits_count;
-                bits_count += (value & 0x1FFF) > 88 ? 13 : 14;
-
-                while (bits_count >= 8) {
-                    decoded.push_back(static_cast<uint8_t>(buffer & 0xFF));
-                    buffer >>= 8;
-                    bits_count -= 8;
-                }
-                value = -1;
-            }
-        }
+    size_t Base91::StreamEncoder::MaxUpdateSize(size_t size) {
+        // Up to 13 pending bits ahead of the new input; every pair takes
+        // at least 13 bits
+        return (size * 8 + 13) / 13 * 2;
+    }
 
-        if (value != -1) {
-            decoded.push_back(static_cast<uint8_t>(
-                    (buffer | (value << bits_count)) & 0xFF));
-        }
-        return decoded;
+    size_t Base91::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const uint8_t *cursor = EncodeBytes(in, out.data(), bits, count);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base91::StreamEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const uint8_t *cursor = EncodeTail(out.data(), bits, count);
+        bits = 0;
+        count = 0;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base91::StreamDecoder::MaxUpdateSize(size_t size) {
+        // A pending character and up to 7 pending bits
+        return ((size + 1) / 2 * 14 + 7) / 8;
+    }
+
+    std::optional<size_t>
+    Base91::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const uint8_t *cursor =
+                DecodeChars(in, out.data(), bits, count, pending);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::optional<size_t>
+    Base91::StreamDecoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const uint8_t *cursor = DecodeTail(out.data(), bits, count, pending);
+        *this = StreamDecoder();
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::vector<uint8_t> Base91::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> Base91::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base91::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base91::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
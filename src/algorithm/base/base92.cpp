@@ -26,112 +26,231 @@
  */
 /* clang-format on */
 #include "base92.h"
-#include <bitset>
+#include "algorithm/common/byte_buffer.h"
+#include <array>
 namespace CryptoToysPP::Algorithm::Base {
-    std::vector<uint8_t> Base92::Encode(const std::vector<uint8_t> &data) {
+    namespace {
         // The valid character set of Base92 consists of 91 characters,
         // of which '~' is a placeholder, not in the character set
         constexpr uint8_t BASE92_CHARS[] =
                 "!#$%&'()*+,-./"
                 "0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
                 "abcdefghijklmnopqrstuvwxyz{|}";
-        if (data.empty())
-            return {};
+        constexpr int8_t INVALID = -1;
+
+        constexpr auto BASE92_TABLE = [] {
+            std::array<int8_t, 256> table{};
+            table.fill(INVALID);
+            for (int8_t i = 0; i < 91; ++i) {
+                table[BASE92_CHARS[i]] = i;
+            }
+            return table;
+        }();
 
-        std::string bitstr;
-        for (const auto b : data) {
-            bitstr += std::bitset<8>(b).to_string();
+        // Input bits are consumed MSB first: every 13 bits become two
+        // characters, a trailing group of at most 6 bits a single one
+        constexpr uint32_t GROUP_BITS = 13;
+        constexpr uint32_t GROUP_MASK = (1u << GROUP_BITS) - 1;
+        constexpr uint32_t TAIL_BITS = 6;
+        constexpr uint32_t TAIL_MASK = (1u << TAIL_BITS) - 1;
+
+        inline uint8_t *PutGroup(uint8_t *cursor, uint32_t value) {
+            *cursor++ = BASE92_CHARS[value / 91];
+            *cursor++ = BASE92_CHARS[value % 91];
+            return cursor;
         }
 
-        std::vector<uint8_t> result;
-        size_t pos = 0;
-        while (pos < bitstr.length()) {
-            std::string chunk = bitstr.substr(pos, 13);
-            pos += chunk.length();
-
-            if (chunk.length() < 13) {
-                if (chunk.length() <= 6) {
-                    chunk += std::string(6 - chunk.length(), '0');
-                    const int32_t val = static_cast<int32_t>(
-                            std::bitset<6>(chunk).to_ulong());
-                    result.push_back(BASE92_CHARS[val]);
-                } else {
-                    chunk += std::string(13 - chunk.length(), '0');
-                    const int32_t high = static_cast<int32_t>(
-                            std::bitset<13>(chunk).to_ulong() / 91);
-                    const int32_t low = static_cast<int32_t>(
-                            std::bitset<13>(chunk).to_ulong() % 91);
-                    result.push_back(BASE92_CHARS[high]);
-                    result.push_back(BASE92_CHARS[low]);
+        // The bit accumulators are kept in locals so the loops run in
+        // registers; `bits` never holds more than 20 significant bits
+        uint8_t *EncodeBits(std::span<const uint8_t> in, uint8_t *cursor,
+                            uint32_t &bits, uint32_t &count) {
+            uint32_t acc = bits;
+            uint32_t n = count;
+            for (const auto b : in) {
+                acc = (acc << 8) | b;
+                n += 8;
+                if (n >= GROUP_BITS) {
+                    n -= GROUP_BITS;
+                    cursor = PutGroup(cursor, (acc >> n) & GROUP_MASK);
+                    acc &= (1u << n) - 1;
                 }
-                break;
             }
+            bits = acc;
+            count = n;
+            return cursor;
+        }
 
-            const int32_t high = static_cast<int32_t>(
-                    std::bitset<13>(chunk).to_ulong() / 91);
-            const int32_t low = static_cast<int32_t>(
-                    std::bitset<13>(chunk).to_ulong() % 91);
-            result.push_back(BASE92_CHARS[high]);
-            result.push_back(BASE92_CHARS[low]);
+        // Zero-pad the pending bits to 6 or 13 bits
+        uint8_t *EncodeTail(uint8_t *cursor, uint32_t bits, uint32_t count) {
+            if (count == 0)
+                return cursor;
+            if (count <= TAIL_BITS) {
+                *cursor++ = BASE92_CHARS[bits << (TAIL_BITS - count)];
+                return cursor;
+            }
+            return PutGroup(cursor, bits << (GROUP_BITS - count));
+        }
+
+        // Character pairs carry 13 bits, truncated like the reference
+        // implementation when the pair value exceeds 8191. A character
+        // without a partner is left in `pending` for DecodeTail. Returns
+        // false on a character outside the alphabet.
+        bool DecodeBits(std::span<const uint8_t> in, uint8_t *&cursor,
+                        uint32_t &bits, uint32_t &count, int32_t &pending) {
+            uint32_t acc = bits;
+            uint32_t n = count;
+            int32_t high = pending;
+            for (const auto c : in) {
+                const int32_t val = BASE92_TABLE[c];
+                if (val == INVALID)
+                    return false;
+                if (high < 0) {
+                    high = val;
+                    continue;
+                }
+                acc = (acc << GROUP_BITS) |
+                      (static_cast<uint32_t>(high * 91 + val) & GROUP_MASK);
+                n += GROUP_BITS;
+                high = -1;
+                while (n >= 8) {
+                    n -= 8;
+                    *cursor++ = static_cast<uint8_t>(acc >> n);
+                }
+                acc &= (1u << n) - 1;
+            }
+            bits = acc;
+            count = n;
+            pending = high;
+            return true;
         }
 
-        return result;
+        // A lone final character contributes 6 bits; incomplete bytes
+        // are dropped
+        uint8_t *DecodeTail(uint8_t *cursor, uint32_t bits, uint32_t count,
+                            int32_t pending) {
+            if (pending < 0)
+                return cursor;
+            bits = (bits << TAIL_BITS) |
+                   (static_cast<uint32_t>(pending) & TAIL_MASK);
+            count += TAIL_BITS;
+            if (count >= 8)
+                *cursor++ = static_cast<uint8_t>(bits >> (count - 8));
+            return cursor;
+        }
+    } // namespace
+
+    size_t Base92::MaxEncodedSize(size_t size) {
+        // Two characters per 13 bits, rounded up
+        return (size / 13 * 8 + (size % 13 * 8 + 12) / 13) * 2;
     }
 
-    std::vector<uint8_t> Base92::Decode(const std::vector<uint8_t> &data) {
-        // The valid character set of Base92 consists of 91 characters,
-        // of which '~' is a placeholder, not in the character set
-        constexpr uint8_t BASE92_CHARS[] =
-                "!#$%&'()*+,-./"
-                "0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
-                "abcdefghijklmnopqrstuvwxyz{|}";
-        if (data.empty())
-            return {};
+    size_t Base92::MaxDecodedSize(size_t size) {
+        return (size / 2 * 13 + (size % 2) * 6) / 8;
+    }
 
-        std::vector table(256, -1);
-        for (int32_t i = 0; i < sizeof(BASE92_CHARS) - 1; ++i) {
-            table[BASE92_CHARS[i]] = i;
-        }
+    size_t Base92::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        uint32_t bits = 0;
+        uint32_t count = 0;
+        uint8_t *cursor = EncodeBits(in, out.data(), bits, count);
+        cursor = EncodeTail(cursor, bits, count);
+        return static_cast<size_t>(cursor - out.data());
+    }
 
-        std::string bitstr;
-        for (size_t i = 0; i < data.size(); ++i) {
-            if (i + 1 < data.size()) {
-                const int32_t high = table[data[i]];
-                const int32_t low = table[data[i + 1]];
-                if (high == -1 || low == -1)
-                    return {};
-
-                const int32_t combined = high * 91 + low;
-                bitstr += std::bitset<13>(combined).to_string();
-                ++i;
-            } else {
-                const int32_t val = table[data[i]];
-                if (val == -1)
-                    return {};
-                bitstr += std::bitset<6>(val).to_string().substr(0, 6);
-            }
+    std::optional<size_t> Base92::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        uint32_t bits = 0;
+        uint32_t count = 0;
+        int32_t pending = -1;
+        uint8_t *cursor = out.data();
+        if (!DecodeBits(in, cursor, bits, count, pending))
+            return std::nullopt;
+        cursor = DecodeTail(cursor, bits, count, pending);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base92::StreamEncoder::MaxUpdateSize(size_t size) {
+        // Up to 12 pending bits ahead of the new input
+        return (size / 13 * 8 + (size % 13 * 8 + 12) / 13) * 2;
+    }
+
+    size_t Base92::StreamEncoder::Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const uint8_t *cursor = EncodeBits(in, out.data(), bits, count);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base92::StreamEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const uint8_t *cursor = EncodeTail(out.data(), bits, count);
+        bits = 0;
+        count = 0;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t Base92::StreamDecoder::MaxUpdateSize(size_t size) {
+        // A pending character and up to 7 pending bits
+        return ((size + 1) / 2 * 13 + 7) / 8;
+    }
+
+    std::optional<size_t>
+    Base92::StreamDecoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        if (failed)
+            return std::nullopt;
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        uint8_t *cursor = out.data();
+        if (!DecodeBits(in, cursor, bits, count, pending)) {
+            failed = true;
+            return std::nullopt;
         }
+        return static_cast<size_t>(cursor - out.data());
+    }
 
-        std::vector<uint8_t> result;
-        for (size_t i = 0; i + 8 <= bitstr.length(); i += 8) {
-            std::string byte = bitstr.substr(i, 8);
-            result.push_back(
-                    static_cast<uint8_t>(std::bitset<8>(byte).to_ulong()));
+    std::optional<size_t>
+    Base92::StreamDecoder::Finish(std::span<uint8_t> out) {
+        const bool valid = !failed;
+        const uint8_t *cursor = out.data();
+        if (valid) {
+            Common::RequireCapacity(out, MAX_FINISH_SIZE);
+            cursor = DecodeTail(out.data(), bits, count, pending);
         }
-        return result;
+        *this = StreamDecoder();
+        if (!valid)
+            return std::nullopt;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::vector<uint8_t> Base92::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> Base92::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string Base92::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string Base92::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Base
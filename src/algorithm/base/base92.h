@@ -28,8 +28,11 @@
 #ifndef BASE92_H
 #define BASE92_H
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <vector>
 #include <string>
+#include "algorithm/common/stream_codec.h"
 namespace CryptoToysPP::Algorithm::Base {
     class Base92 {
     public:
@@ -40,6 +43,67 @@ namespace CryptoToysPP::Algorithm::Base {
         static std::string Encode(const std::string &data);
 
         static std::string Decode(const std::string &data);
+
+        // Output sizes for the caller-provided buffers below
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out);
+
+        // Decode into `out` (MaxDecodedSize(in.size()) bytes); returns the
+        // bytes written, or std::nullopt for malformed input
+        static std::optional<size_t> Decode(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out);
+
+        // Incremental encoding: feeding the input in pieces gives the same
+        // output as a single Encode. Update needs MaxUpdateSize(in.size())
+        // bytes of room and Finish MAX_FINISH_SIZE.
+        class StreamEncoder : public Common::StreamEncoderBase<StreamEncoder> {
+        public:
+            using StreamEncoderBase::Finish;
+            using StreamEncoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 2;
+
+            static size_t MaxUpdateSize(size_t size);
+
+            size_t Update(std::span<const uint8_t> in,
+                          std::span<uint8_t> out);
+
+            // Flush the partial group and reset for a new stream
+            size_t Finish(std::span<uint8_t> out);
+
+        private:
+            uint32_t bits = 0;  // pending input bits, right-aligned
+            uint32_t count = 0; // number of pending bits, below 13
+        };
+
+        // Incremental decoding; after malformed input every call returns
+        // std::nullopt until Finish resets the decoder
+        class StreamDecoder : public Common::StreamDecoderBase<StreamDecoder> {
+        public:
+            using StreamDecoderBase::Finish;
+            using StreamDecoderBase::Update;
+
+            static constexpr size_t MAX_FINISH_SIZE = 1;
+
+            static size_t MaxUpdateSize(size_t size);
+
+            std::optional<size_t> Update(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out);
+
+            std::optional<size_t> Finish(std::span<uint8_t> out);
+
+        private:
+            uint32_t bits = 0;   // pending output bits, right-aligned
+            uint32_t count = 0;  // number of pending bits, below 8
+            int32_t pending = -1; // value of an unpaired character
+            bool failed = false;
+        };
     };
 } // namespace CryptoToysPP::Algorithm::Base
 #endif // BASE92_H
@@ -0,0 +1,364 @@
+/* clang-format off */
+/*
+ * @file radix.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "radix.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    namespace {
+        // Little-endian limbs; every limb is below the radix of its number
+        using Limbs = std::vector<uint32_t>;
+
+        constexpr uint64_t BINARY_RADIX = uint64_t{1} << 32;
+
+        // Digits packed per limb: base^5 stays below 2^32 for base <= 84,
+        // so limb products and carries fit in 64 bits
+        constexpr size_t DIGITS_PER_LIMB = 5;
+
+        // Operands from this many limbs on are multiplied with Karatsuba
+        constexpr size_t KARATSUBA_THRESHOLD = 32;
+
+        // Numbers longer than this many limbs are split in two around a
+        // precomputed power of the source radix
+        constexpr size_t SPLIT_THRESHOLD = 64;
+
+        constexpr uint64_t DigitRadix(uint32_t base) {
+            uint64_t radix = 1;
+            for (size_t i = 0; i < DIGITS_PER_LIMB; ++i)
+                radix *= base;
+            return radix;
+        }
+
+        void Trim(Limbs &limbs) {
+            while (!limbs.empty() && limbs.back() == 0)
+                limbs.pop_back();
+        }
+
+        size_t TrimmedSize(const uint32_t *limbs, size_t size) {
+            while (size > 0 && limbs[size - 1] == 0)
+                --size;
+            return size;
+        }
+
+        // Arithmetic on little-endian limbs in radix RADIX (at most 2^32).
+        // The radix is a template constant so % and / compile to
+        // multiplications.
+        template<uint64_t RADIX>
+        struct Arithmetic {
+            // r[0, rn) += a[0, an) with an <= rn; returns the carry out
+            static uint32_t Add(uint32_t *r,
+                                size_t rn,
+                                const uint32_t *a,
+                                size_t an) {
+                uint64_t carry = 0;
+                size_t i = 0;
+                for (; i < an; ++i) {
+                    const uint64_t sum = uint64_t{r[i]} + a[i] + carry;
+                    r[i] = static_cast<uint32_t>(sum % RADIX);
+                    carry = sum / RADIX;
+                }
+                for (; carry != 0 && i < rn; ++i) {
+                    const uint64_t sum = uint64_t{r[i]} + carry;
+                    r[i] = static_cast<uint32_t>(sum % RADIX);
+                    carry = sum / RADIX;
+                }
+                return static_cast<uint32_t>(carry);
+            }
+
+            // r[0, rn) -= a[0, an) with an <= rn and r >= a
+            static void Sub(uint32_t *r,
+                            size_t rn,
+                            const uint32_t *a,
+                            size_t an) {
+                uint64_t borrow = 0;
+                size_t i = 0;
+                for (; i < an || (borrow != 0 && i < rn); ++i) {
+                    const uint64_t sub = (i < an ? a[i] : 0) + borrow;
+                    if (r[i] >= sub) {
+                        r[i] = static_cast<uint32_t>(r[i] - sub);
+                        borrow = 0;
+                    } else {
+                        r[i] = static_cast<uint32_t>(r[i] + RADIX - sub);
+                        borrow = 1;
+                    }
+                }
+            }
+
+            // r[0, an + bn) = a * b
+            static void MulSchool(const uint32_t *a,
+                                  size_t an,
+                                  const uint32_t *b,
+                                  size_t bn,
+                                  uint32_t *r) {
+                std::fill(r, r + an + bn, 0);
+                for (size_t i = 0; i < an; ++i) {
+                    // (RADIX - 1)^2 + 2 * (RADIX - 1) < 2^64
+                    uint64_t carry = 0;
+                    const uint64_t ai = a[i];
+                    for (size_t j = 0; j < bn; ++j) {
+                        const uint64_t acc = ai * b[j] + r[i + j] + carry;
+                        r[i + j] = static_cast<uint32_t>(acc % RADIX);
+                        carry = acc / RADIX;
+                    }
+                    r[i + bn] = static_cast<uint32_t>(carry);
+                }
+            }
+
+            // r[0, an + bn) = a * b
+            static void Mul(const uint32_t *a,
+                            size_t an,
+                            const uint32_t *b,
+                            size_t bn,
+                            uint32_t *r) {
+                if (an < bn) {
+                    std::swap(a, b);
+                    std::swap(an, bn);
+                }
+                if (bn < KARATSUBA_THRESHOLD) {
+                    MulSchool(a, an, b, bn, r);
+                    return;
+                }
+
+                const size_t half = (an + 1) / 2;
+                if (bn <= half) {
+                    // Unbalanced: a0 * b + (a1 * b) * RADIX^half
+                    Mul(a, half, b, bn, r);
+                    std::fill(r + half + bn, r + an + bn, 0);
+                    Limbs high(an - half + bn);
+                    Mul(a + half, an - half, b, bn, high.data());
+                    Add(r + half, an + bn - half, high.data(),
+                        TrimmedSize(high.data(), high.size()));
+                    return;
+                }
+
+                // z0 = a0 * b0 and z2 = a1 * b1 go straight into r; the
+                // middle term (a0 + a1)(b0 + b1) - z0 - z2 is added on top
+                const uint32_t *a1 = a + half;
+                const uint32_t *b1 = b + half;
+                const size_t a1n = an - half;
+                const size_t b1n = bn - half;
+                Mul(a, half, b, half, r);
+                Mul(a1, a1n, b1, b1n, r + 2 * half);
+
+                Limbs sumA(a, a + half), sumB(b, b + half);
+                sumA.push_back(Add(sumA.data(), half, a1, a1n));
+                sumB.push_back(Add(sumB.data(), half, b1, b1n));
+                Limbs middle(sumA.size() + sumB.size());
+                Mul(sumA.data(), sumA.size(), sumB.data(), sumB.size(),
+                    middle.data());
+                Sub(middle.data(), middle.size(), r, 2 * half);
+                Sub(middle.data(), middle.size(), r + 2 * half,
+                    a1n + b1n);
+                Add(r + half, an + bn - half, middle.data(),
+                    TrimmedSize(middle.data(), middle.size()));
+            }
+
+            static Limbs Mul(const Limbs &a, const Limbs &b) {
+                if (a.empty() || b.empty())
+                    return {};
+                Limbs r(a.size() + b.size());
+                Mul(a.data(), a.size(), b.data(), b.size(), r.data());
+                Trim(r);
+                return r;
+            }
+        };
+
+        // Converts numbers from radix FROM limbs to radix TO limbs
+        template<uint64_t FROM, uint64_t TO>
+        class Converter {
+        public:
+            Limbs Convert(const uint32_t *src, size_t n) {
+                n = TrimmedSize(src, n);
+                if (n <= SPLIT_THRESHOLD)
+                    return ConvertSchool(src, n);
+
+                // value = high * FROM^m + low, with m = SPLIT_THRESHOLD *
+                // 2^k the largest such split below n, so the powers are
+                // shared by every level of the recursion
+                size_t k = 0;
+                while ((SPLIT_THRESHOLD << (k + 1)) < n)
+                    ++k;
+                const size_t m = SPLIT_THRESHOLD << k;
+                Limbs result = Arithmetic<TO>::Mul(Convert(src + m, n - m),
+                                                   Power(k));
+                const Limbs low = Convert(src, m);
+                if (result.size() < low.size())
+                    result.resize(low.size());
+                result.push_back(0);
+                Arithmetic<TO>::Add(result.data(), result.size(),
+                                    low.data(), low.size());
+                Trim(result);
+                return result;
+            }
+
+        private:
+            // Horner's scheme, one source limb at a time
+            static Limbs ConvertSchool(const uint32_t *src, size_t n) {
+                Limbs result;
+                for (size_t i = n; i-- > 0;) {
+                    uint64_t carry = src[i];
+                    for (uint32_t &limb : result) {
+                        const uint64_t acc = limb * FROM + carry;
+                        limb = static_cast<uint32_t>(acc % TO);
+                        carry = acc / TO;
+                    }
+                    while (carry != 0) {
+                        result.push_back(static_cast<uint32_t>(carry % TO));
+                        carry /= TO;
+                    }
+                }
+                return result;
+            }
+
+            // FROM^(SPLIT_THRESHOLD * 2^k) in radix TO
+            const Limbs &Power(size_t k) {
+                if (powers.empty()) {
+                    Limbs one(SPLIT_THRESHOLD + 1, 0);
+                    one.back() = 1;
+                    powers.push_back(ConvertSchool(one.data(), one.size()));
+                }
+                while (powers.size() <= k)
+                    powers.push_back(Arithmetic<TO>::Mul(powers.back(),
+                                                         powers.back()));
+                return powers[k];
+            }
+
+            std::vector<Limbs> powers;
+        };
+
+        template<uint32_t BASE>
+        size_t Encode(std::span<const uint8_t> bytes,
+                      const RadixAlphabet &alphabet,
+                      uint8_t *out) {
+            constexpr uint64_t RADIX = DigitRadix(BASE);
+            while (!bytes.empty() && bytes.front() == 0)
+                bytes = bytes.subspan(1);
+
+            // Big-endian bytes -> little-endian 32-bit limbs
+            Limbs source((bytes.size() + 3) / 4);
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                const size_t shift = i % 4 * 8;
+                source[i / 4] |= uint32_t{bytes[bytes.size() - 1 - i]}
+                        << shift;
+            }
+            const Limbs limbs =
+                    Converter<BINARY_RADIX, RADIX>().Convert(source.data(),
+                                                             source.size());
+            if (limbs.empty())
+                return 0;
+
+            uint8_t *cursor = out;
+            uint8_t group[DIGITS_PER_LIMB];
+            for (size_t i = limbs.size(); i-- > 0;) {
+                uint32_t limb = limbs[i];
+                for (size_t j = DIGITS_PER_LIMB; j-- > 0;) {
+                    group[j] = alphabet.chars[limb % BASE];
+                    limb /= BASE;
+                }
+                // Only the most significant limb drops leading zeros
+                size_t skip = 0;
+                if (i + 1 == limbs.size()) {
+                    while (group[skip] == alphabet.chars[0])
+                        ++skip;
+                }
+                cursor = std::copy(group + skip, group + DIGITS_PER_LIMB,
+                                   cursor);
+            }
+            return static_cast<size_t>(cursor - out);
+        }
+
+        template<uint32_t BASE>
+        std::optional<size_t> Decode(std::span<const uint8_t> digits,
+                                     const RadixAlphabet &alphabet,
+                                     uint8_t *out) {
+            constexpr uint64_t RADIX = DigitRadix(BASE);
+
+            // Big-endian digits -> little-endian limbs of five digits
+            Limbs source((digits.size() + DIGITS_PER_LIMB - 1) /
+                         DIGITS_PER_LIMB);
+            for (size_t l = 0; l < source.size(); ++l) {
+                const size_t end = digits.size() - l * DIGITS_PER_LIMB;
+                const size_t begin =
+                        end >= DIGITS_PER_LIMB ? end - DIGITS_PER_LIMB : 0;
+                uint32_t limb = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    const uint8_t value = alphabet.values[digits[i]];
+                    if (value == RADIX_INVALID)
+                        return std::nullopt;
+                    limb = limb * BASE + value;
+                }
+                source[l] = limb;
+            }
+            const Limbs limbs =
+                    Converter<RADIX, BINARY_RADIX>().Convert(source.data(),
+                                                             source.size());
+            if (limbs.empty())
+                return 0;
+
+            uint8_t *cursor = out;
+            const uint32_t top = limbs.back();
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                if (cursor != out || (top >> shift) != 0)
+                    *cursor++ = static_cast<uint8_t>(top >> shift);
+            }
+            for (size_t i = limbs.size() - 1; i-- > 0;) {
+                *cursor++ = static_cast<uint8_t>(limbs[i] >> 24);
+                *cursor++ = static_cast<uint8_t>(limbs[i] >> 16);
+                *cursor++ = static_cast<uint8_t>(limbs[i] >> 8);
+                *cursor++ = static_cast<uint8_t>(limbs[i]);
+            }
+            return static_cast<size_t>(cursor - out);
+        }
+    } // namespace
+
+    size_t RadixEncode(std::span<const uint8_t> bytes,
+                       const RadixAlphabet &alphabet,
+                       uint8_t *out) {
+        switch (alphabet.base) {
+            case 58:
+                return Encode<58>(bytes, alphabet, out);
+            case 62:
+                return Encode<62>(bytes, alphabet, out);
+            default:
+                throw std::invalid_argument("Unsupported radix");
+        }
+    }
+
+    std::optional<size_t> RadixDecode(std::span<const uint8_t> digits,
+                                      const RadixAlphabet &alphabet,
+                                      uint8_t *out) {
+        switch (alphabet.base) {
+            case 58:
+                return Decode<58>(digits, alphabet, out);
+            case 62:
+                return Decode<62>(digits, alphabet, out);
+            default:
+                throw std::invalid_argument("Unsupported radix");
+        }
+    }
+} // namespace CryptoToysPP::Algorithm::Base::Detail
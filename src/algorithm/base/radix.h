@@ -0,0 +1,85 @@
+/* clang-format off */
+/*
+ * @file radix.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef RADIX_H
+#define RADIX_H
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+namespace CryptoToysPP::Algorithm::Base::Detail {
+    inline constexpr uint8_t RADIX_INVALID = 0xFF;
+
+    // Alphabet of a positional (big-number) encoding such as Base58
+    struct RadixAlphabet {
+        uint32_t base;
+        uint8_t chars[64];   // value -> character
+        uint8_t values[256]; // character -> value or RADIX_INVALID
+    };
+
+    constexpr RadixAlphabet MakeRadixAlphabet(const char *chars,
+                                              uint32_t base) {
+        RadixAlphabet alphabet{};
+        alphabet.base = base;
+        for (auto &value : alphabet.values)
+            value = RADIX_INVALID;
+        for (uint32_t i = 0; i < base; ++i) {
+            alphabet.chars[i] = static_cast<uint8_t>(chars[i]);
+            alphabet.values[alphabet.chars[i]] = static_cast<uint8_t>(i);
+        }
+        return alphabet;
+    }
+
+    inline constexpr RadixAlphabet BASE58_ALPHABET = MakeRadixAlphabet(
+            "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz", 58);
+
+    inline constexpr RadixAlphabet BASE62_ALPHABET = MakeRadixAlphabet(
+            "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz",
+            62);
+
+    // Write the big-endian number in `bytes` as digits of `alphabet`,
+    // most significant first and without leading zero digits (so zero
+    // gives no digits at all). `out` must hold ceil(bytes.size() *
+    // log(256) / log(base)) characters. Returns the number written.
+    //
+    // Small inputs use quadratic conversion on 32-bit limbs packing five
+    // digits per limb; larger ones are split recursively around
+    // precomputed powers and recombined with Karatsuba multiplication.
+    size_t RadixEncode(std::span<const uint8_t> bytes,
+                       const RadixAlphabet &alphabet,
+                       uint8_t *out);
+
+    // Inverse of RadixEncode: parse `digits` into the minimal big-endian
+    // byte string (none for zero). `out` must hold ceil(digits.size() *
+    // log(base) / log(256)) bytes. Returns std::nullopt on a character
+    // outside the alphabet.
+    std::optional<size_t> RadixDecode(std::span<const uint8_t> digits,
+                                      const RadixAlphabet &alphabet,
+                                      uint8_t *out);
+} // namespace CryptoToysPP::Algorithm::Base::Detail
+
+#endif // RADIX_H
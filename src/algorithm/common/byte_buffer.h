@@ -0,0 +1,84 @@
+/* clang-format off */
+/*
+ * @file byte_buffer.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BYTE_BUFFER_H
+#define BYTE_BUFFER_H
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+namespace CryptoToysPP::Algorithm::Common {
+    inline std::span<const uint8_t> AsBytes(std::string_view text) {
+        return {reinterpret_cast<const uint8_t *>(text.data()), text.size()};
+    }
+
+    inline std::span<uint8_t> AsWritableBytes(std::string &text) {
+        return {reinterpret_cast<uint8_t *>(text.data()), text.size()};
+    }
+
+    // Guard for the span-based codec overloads: callers size `out` with the
+    // codec's Max*Size helpers, anything smaller is a programming error
+    inline void RequireCapacity(std::span<const uint8_t> out,
+                                size_t required) {
+        if (out.size() < required)
+            throw std::length_error(
+                    "Output buffer too small: " + std::to_string(out.size()) +
+                    " < " + std::to_string(required));
+    }
+
+    // Allocate a Container of `bound` bytes once, let `writer` fill it
+    // through a span and trim it to the size the writer reports. Capacity
+    // is released when the bound turned out to be far too generous.
+    template<typename Container, typename Writer>
+    Container FillBuffer(size_t bound, Writer &&writer) {
+        Container buffer(bound, 0);
+        const size_t written = writer(std::span<uint8_t>(
+                reinterpret_cast<uint8_t *>(buffer.data()), buffer.size()));
+        buffer.resize(written);
+        if (written < bound / 2)
+            buffer.shrink_to_fit();
+        return buffer;
+    }
+
+    // Same as FillBuffer for writers returning std::optional<size_t>; a
+    // failed write yields an empty Container
+    template<typename Container, typename Writer>
+    Container TryFillBuffer(size_t bound, Writer &&writer) {
+        std::optional<size_t> written;
+        Container buffer = FillBuffer<Container>(bound, [&](auto out) {
+            written = writer(out);
+            return written.value_or(0);
+        });
+        if (!written)
+            return {};
+        return buffer;
+    }
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // BYTE_BUFFER_H
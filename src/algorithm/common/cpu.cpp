@@ -0,0 +1,159 @@
+/* clang-format off */
+/*
+ * @file cpu.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "cpu.h"
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#if defined(CRYPTOTOYSPP_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+namespace CryptoToysPP::Algorithm::Common {
+    namespace {
+#if defined(CRYPTOTOYSPP_X86)
+        void Cpuid(uint32_t leaf, uint32_t subLeaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+            for (int i = 0; i < 4; ++i)
+                regs[i] = static_cast<uint32_t>(info[i]);
+#else
+            __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        // Register state the OS saves on context switch (XCR0)
+        uint64_t ReadXcr0() {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t eax = 0;
+            uint32_t edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+        }
+#endif
+
+        CpuFeatures Detect() {
+            CpuFeatures features;
+#if defined(CRYPTOTOYSPP_X86)
+            uint32_t regs[4] = {};
+            Cpuid(0, 0, regs);
+            const uint32_t maxLeaf = regs[0];
+            if (maxLeaf < 1)
+                return features;
+
+            Cpuid(1, 0, regs);
+            const bool ssse3 = (regs[2] & (1u << 9)) != 0;
+            features.sse41 = ssse3 && (regs[2] & (1u << 19)) != 0;
+            const bool osxsave = (regs[2] & (1u << 27)) != 0;
+            const bool avx = (regs[2] & (1u << 28)) != 0;
+            if (!osxsave || !avx || maxLeaf < 7)
+                return features;
+
+            const uint64_t xcr0 = ReadXcr0();
+            const bool ymmState = (xcr0 & 0x06) == 0x06;
+            const bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+            Cpuid(7, 0, regs);
+            const uint32_t ebx = regs[1];
+            const uint32_t ecx = regs[2];
+            features.avx2 = ymmState && (ebx & (1u << 5)) != 0;
+            const bool avx512f = (ebx & (1u << 16)) != 0;
+            const bool avx512bw = (ebx & (1u << 30)) != 0;
+            const bool avx512vl = (ebx & (1u << 31)) != 0;
+            features.avx512bw = features.avx2 && zmmState && avx512f &&
+                    avx512bw && avx512vl;
+            features.avx512vbmi =
+                    features.avx512bw && (ecx & (1u << 1)) != 0;
+#elif defined(CRYPTOTOYSPP_NEON)
+            features.neon = true;
+#endif
+            return features;
+        }
+
+        // Apply the CRYPTOTOYSPP_SIMD cap, used to compare kernels
+        void ApplyLimit(CpuFeatures &features) {
+            const char *env = std::getenv("CRYPTOTOYSPP_SIMD");
+            if (env == nullptr)
+                return;
+            const std::string_view limit(env);
+            if (limit == "scalar") {
+                features = CpuFeatures{};
+            } else if (limit == "sse41") {
+                features.avx2 = false;
+                features.avx512bw = false;
+                features.avx512vbmi = false;
+            } else if (limit == "avx2") {
+                features.avx512bw = false;
+                features.avx512vbmi = false;
+            }
+        }
+    } // namespace
+
+    const CpuFeatures &GetCpuFeatures() {
+        static const CpuFeatures features = [] {
+            CpuFeatures detected = Detect();
+            ApplyLimit(detected);
+            return detected;
+        }();
+        return features;
+    }
+
+    SimdLevel GetSimdLevel() {
+        const CpuFeatures &features = GetCpuFeatures();
+        if (features.avx512vbmi)
+            return SimdLevel::AVX512;
+        if (features.avx2)
+            return SimdLevel::AVX2;
+        if (features.sse41)
+            return SimdLevel::SSE41;
+        if (features.neon)
+            return SimdLevel::NEON;
+        return SimdLevel::SCALAR;
+    }
+
+    std::string SimdLevelToString(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::SSE41:
+                return "SSE4.1";
+            case SimdLevel::AVX2:
+                return "AVX2";
+            case SimdLevel::AVX512:
+                return "AVX-512";
+            case SimdLevel::NEON:
+                return "NEON";
+            default:
+                return "scalar";
+        }
+    }
+} // namespace CryptoToysPP::Algorithm::Common
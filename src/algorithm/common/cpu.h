@@ -0,0 +1,78 @@
+/* clang-format off */
+/*
+ * @file cpu.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef CPU_H
+#define CPU_H
+#include <string>
+
+// Instruction sets the SIMD kernels can be built for. x86 kernels are
+// compiled with per-function target attributes, so the rest of the build
+// keeps the baseline ISA and the right kernel is picked at runtime.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||            \
+        defined(_M_IX86)
+#define CRYPTOTOYSPP_X86 1
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define CRYPTOTOYSPP_NEON 1
+#endif
+
+#if defined(CRYPTOTOYSPP_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CRYPTOTOYSPP_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CRYPTOTOYSPP_TARGET(isa)
+#endif
+
+namespace CryptoToysPP::Algorithm::Common {
+    // Highest instruction set a kernel may use
+    enum class SimdLevel {
+        SCALAR,
+        SSE41,  // SSSE3 shuffles + SSE4.1
+        AVX2,   // AVX2
+        AVX512, // AVX-512 F/BW/VL + VBMI
+        NEON    // AArch64 Advanced SIMD
+    };
+
+    struct CpuFeatures {
+        bool sse41 = false;
+        bool avx2 = false;
+        bool avx512bw = false;   // F + BW + VL
+        bool avx512vbmi = false; // implies avx512bw
+        bool neon = false;
+    };
+
+    // Features of the running CPU (and OS), capped by the CRYPTOTOYSPP_SIMD
+    // environment variable ("scalar", "sse41", "avx2", "avx512") when set.
+    // Detected once; safe to call from any thread.
+    const CpuFeatures &GetCpuFeatures();
+
+    SimdLevel GetSimdLevel();
+
+    std::string SimdLevelToString(SimdLevel level);
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // CPU_H
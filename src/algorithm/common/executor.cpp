@@ -0,0 +1,255 @@
+/* clang-format off */
+/*
+ * @file executor.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "executor.h"
+#include <algorithm>
+#include <exception>
+#include <spdlog/spdlog.h>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+namespace CryptoToysPP::Algorithm::Common {
+    namespace {
+        // Executor and deque index of the current worker thread, if any
+        thread_local const Executor *currentExecutor = nullptr;
+        thread_local size_t currentIndex = 0;
+
+        void PinCurrentThread(size_t core) {
+#if defined(_WIN32)
+            if (core < sizeof(DWORD_PTR) * 8)
+                SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{1}
+                                                                  << core);
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core % CPU_SETSIZE, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+            (void) core;
+#endif
+        }
+    } // namespace
+
+    Executor::Executor() : Executor(Options{}) {
+    }
+
+    Executor::Executor(const Options &options) {
+        size_t threads = options.threads;
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+            workers.push_back(std::make_unique<Worker>());
+        for (size_t i = 0; i < threads; ++i) {
+            workers[i]->thread = std::thread(&Executor::WorkerLoop, this, i,
+                                             options.pinThreads);
+        }
+        spdlog::debug("Executor started with {} workers", threads);
+    }
+
+    Executor::~Executor() {
+        {
+            std::lock_guard lock(sleepMutex);
+            stopping = true;
+        }
+        wakeup.notify_all();
+        for (auto &worker : workers) {
+            if (worker->thread.joinable())
+                worker->thread.join();
+        }
+    }
+
+    Executor &Executor::Shared() {
+        static Executor executor;
+        return executor;
+    }
+
+    void Executor::Submit(Task task) {
+        // Workers keep their own tasks local; other threads spread round
+        // robin
+        const size_t index = currentExecutor == this
+                ? currentIndex
+                : nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                        workers.size();
+        Worker &worker = *workers[index];
+        {
+            std::lock_guard lock(worker.mutex);
+            worker.tasks.push_back(std::move(task));
+            worker.maxDepth = std::max(worker.maxDepth, worker.tasks.size());
+        }
+        submitted.fetch_add(1, std::memory_order_relaxed);
+        {
+            // Taken so a worker between its check and its wait sees it
+            std::lock_guard lock(sleepMutex);
+            pending.fetch_add(1, std::memory_order_release);
+        }
+        wakeup.notify_one();
+    }
+
+    void Executor::ParallelFor(
+            size_t count,
+            size_t grain,
+            const std::function<void(size_t, size_t)> &body) {
+        if (count == 0)
+            return;
+        grain = std::max<size_t>(1, grain);
+        const size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1) {
+            body(0, count);
+            return;
+        }
+
+        // Chunks are claimed from a shared counter, so helpers that start
+        // late (or after everything is done) simply find nothing to do
+        struct State {
+            std::atomic<size_t> next{0};
+            std::atomic<size_t> done{0};
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr error;
+        };
+        auto state = std::make_shared<State>();
+        const size_t chunkSize = (count + chunks - 1) / chunks;
+
+        auto work = [state, &body, count, chunkSize, chunks] {
+            while (true) {
+                const size_t chunk = state->next.fetch_add(1);
+                if (chunk >= chunks)
+                    return;
+                const size_t begin = chunk * chunkSize;
+                const size_t end = std::min(count, begin + chunkSize);
+                try {
+                    if (begin < end)
+                        body(begin, end);
+                } catch (...) {
+                    std::lock_guard lock(state->mutex);
+                    if (!state->error)
+                        state->error = std::current_exception();
+                }
+                if (state->done.fetch_add(1) + 1 == chunks) {
+                    std::lock_guard lock(state->mutex);
+                    state->finished.notify_all();
+                }
+            }
+        };
+
+        // `body` is only touched while chunks remain, i.e. before this
+        // function returns; late helpers exit without calling it
+        const size_t helpers = std::min(workers.size(), chunks - 1);
+        for (size_t i = 0; i < helpers; ++i)
+            Submit(work);
+        work();
+
+        std::unique_lock lock(state->mutex);
+        state->finished.wait(lock,
+                             [&] { return state->done.load() == chunks; });
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+    size_t Executor::ThreadCount() const {
+        return workers.size();
+    }
+
+    Executor::Stats Executor::GetStats() const {
+        Stats stats;
+        stats.threads = workers.size();
+        stats.submitted = submitted.load(std::memory_order_relaxed);
+        stats.executed = executed.load(std::memory_order_relaxed);
+        stats.stolen = stolen.load(std::memory_order_relaxed);
+        for (const auto &worker : workers) {
+            std::lock_guard lock(worker->mutex);
+            stats.depths.push_back(worker->tasks.size());
+            stats.maxDepths.push_back(worker->maxDepth);
+        }
+        return stats;
+    }
+
+    bool Executor::TakeTask(size_t index, Task &task) {
+        {
+            Worker &own = *workers[index];
+            std::lock_guard lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t offset = 1; offset < workers.size(); ++offset) {
+            Worker &victim = *workers[(index + offset) % workers.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                stolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Executor::RunTask(Task &task) {
+        try {
+            task();
+        } catch (const std::exception &e) {
+            spdlog::error("Executor task failed: {}", e.what());
+        } catch (...) {
+            spdlog::error("Executor task failed with an unknown exception");
+        }
+    }
+
+    void Executor::WorkerLoop(size_t index, bool pin) {
+        currentExecutor = this;
+        currentIndex = index;
+        if (pin)
+            PinCurrentThread(index);
+
+        while (true) {
+            Task task;
+            if (TakeTask(index, task)) {
+                pending.fetch_sub(1, std::memory_order_acq_rel);
+                RunTask(task);
+                executed.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::unique_lock lock(sleepMutex);
+            wakeup.wait(lock, [this] {
+                return stopping || pending.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping && pending.load(std::memory_order_acquire) == 0)
+                return;
+        }
+    }
+} // namespace CryptoToysPP::Algorithm::Common
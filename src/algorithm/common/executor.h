@@ -0,0 +1,121 @@
+/* clang-format off */
+/*
+ * @file executor.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Common {
+    // Work-stealing task executor. Every worker owns a deque: it pushes and
+    // pops its own tasks at the back, idle workers steal from the front of
+    // the others. Algorithms split large inputs with ParallelFor instead of
+    // starting their own threads; the calling thread takes part, so nested
+    // use from a worker (or from Route's dispatcher threads) cannot
+    // deadlock.
+    class Executor {
+    public:
+        using Task = std::function<void()>;
+
+        struct Options {
+            // Worker threads (0: one per hardware thread)
+            size_t threads = 0;
+            // Pin worker i to core i (Linux and Windows only)
+            bool pinThreads = false;
+        };
+
+        struct Stats {
+            size_t threads = 0;
+            uint64_t submitted = 0;
+            uint64_t executed = 0;
+            uint64_t stolen = 0;           // Tasks run by a non-owner worker
+            std::vector<size_t> depths;    // Current depth per worker deque
+            std::vector<size_t> maxDepths; // High-water mark per deque
+        };
+
+        Executor();
+
+        explicit Executor(const Options &options);
+
+        ~Executor();
+
+        Executor(const Executor &) = delete;
+
+        Executor &operator=(const Executor &) = delete;
+
+        // Process-wide executor shared by all algorithm paths
+        static Executor &Shared();
+
+        // Run a task asynchronously. Exceptions are logged and dropped.
+        void Submit(Task task);
+
+        // Call body(begin, end) over [0, count) in chunks of at least
+        // `grain` items and return when all are done. The first exception
+        // thrown by a chunk is rethrown here.
+        void ParallelFor(size_t count,
+                         size_t grain,
+                         const std::function<void(size_t, size_t)> &body);
+
+        [[nodiscard]] size_t ThreadCount() const;
+
+        [[nodiscard]] Stats GetStats() const;
+
+    private:
+        struct Worker {
+            mutable std::mutex mutex;
+            std::deque<Task> tasks;
+            size_t maxDepth = 0;
+            std::thread thread;
+        };
+
+        void WorkerLoop(size_t index, bool pin);
+
+        // Pop from worker `index` or steal from another; false if all empty
+        bool TakeTask(size_t index, Task &task);
+
+        static void RunTask(Task &task);
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::mutex sleepMutex;
+        std::condition_variable wakeup;
+        std::atomic<size_t> pending{0};
+        std::atomic<size_t> nextWorker{0};
+        std::atomic<uint64_t> submitted{0};
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> stolen{0};
+        bool stopping = false;
+    };
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // EXECUTOR_H
@@ -0,0 +1,317 @@
+/* clang-format off */
+/*
+ * @file file_source.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "file_source.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <fcntl.h>
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+namespace CryptoToysPP::Algorithm::Common {
+    namespace {
+        // Page-aligned so reads can bypass copies inside the C library
+        constexpr size_t ALIGNMENT = 4096;
+
+        struct AlignedDelete {
+            void operator()(uint8_t *data) const {
+                ::operator delete[](data, std::align_val_t{ALIGNMENT});
+            }
+        };
+
+        using AlignedBuffer = std::unique_ptr<uint8_t[], AlignedDelete>;
+
+        AlignedBuffer MakeBuffer(size_t size) {
+            return AlignedBuffer(static_cast<uint8_t *>(
+                    ::operator new[](size, std::align_val_t{ALIGNMENT})));
+        }
+    } // namespace
+
+    struct FileSource::Impl {
+        std::string path;
+        Access access = Access::MAP;
+
+        // Memory-mapped regular file
+        bool mapped = false;
+        const uint8_t *base = nullptr;
+        size_t size = 0;
+        size_t offset = 0;
+#if defined(_WIN32)
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#endif
+
+        // Double-buffered reads: the background thread fills one buffer
+        // while the consumer holds the other
+        std::FILE *stream = nullptr;
+        bool ownsStream = false;
+        AlignedBuffer buffers[2];
+        size_t filled[2] = {};
+        bool ready[2] = {};
+        size_t current = 0;   // buffer the consumer reads next
+        bool holding = false; // consumer still holds `current`
+        bool failed = false;
+        bool stopping = false;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::thread reader;
+
+        // Open the path once: regular files are mapped (Access::MAP),
+        // anything else
+        // (pipes, devices) keeps the open handle as `stream` for the
+        // reader, since reopening a FIFO would lose what was written
+        bool Map();
+
+        // Take over an opened handle for the reader thread
+        void AdoptStream(std::FILE *opened);
+
+        void Unmap();
+
+        void StartReader();
+
+        void ReadLoop();
+    };
+
+#if defined(_WIN32)
+    bool FileSource::Impl::Map() {
+        file = CreateFileW(std::filesystem::path(path).c_str(), GENERIC_READ,
+                           FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER length;
+        if (access != Access::MAP || GetFileType(file) != FILE_TYPE_DISK ||
+            !GetFileSizeEx(file, &length) ||
+            static_cast<uint64_t>(length.QuadPart) > SIZE_MAX) {
+            const int fd = _open_osfhandle(reinterpret_cast<intptr_t>(file),
+                                           _O_RDONLY | _O_BINARY);
+            if (fd < 0)
+                return false; // Unmap() still closes the handle
+            file = INVALID_HANDLE_VALUE; // Now owned by the descriptor
+            std::FILE *opened = _fdopen(fd, "rb");
+            if (opened == nullptr) {
+                _close(fd);
+                return false;
+            }
+            AdoptStream(opened);
+            return false;
+        }
+        size = static_cast<size_t>(length.QuadPart);
+        if (size > 0) {
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0,
+                                         nullptr);
+            if (mapping != nullptr)
+                base = static_cast<const uint8_t *>(
+                        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if (base == nullptr) {
+                Unmap();
+                return false;
+            }
+        }
+        mapped = true;
+        return true;
+    }
+
+    void FileSource::Impl::Unmap() {
+        if (base != nullptr)
+            UnmapViewOfFile(base);
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        base = nullptr;
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+    }
+#else
+    bool FileSource::Impl::Map() {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        // Anything that cannot be mapped is read through the same
+        // descriptor
+        auto adopt = [&] {
+            std::FILE *opened = fdopen(fd, "rb");
+            if (opened == nullptr) {
+                close(fd);
+                return false;
+            }
+            AdoptStream(opened);
+            return false;
+        };
+        struct stat info {};
+        if (access != Access::MAP || fstat(fd, &info) != 0 ||
+            !S_ISREG(info.st_mode) ||
+            static_cast<uint64_t>(info.st_size) > SIZE_MAX)
+            return adopt();
+        size = static_cast<size_t>(info.st_size);
+        if (size > 0) {
+            void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view == MAP_FAILED) {
+                size = 0;
+                return adopt();
+            }
+            base = static_cast<const uint8_t *>(view);
+            madvise(view, size, MADV_SEQUENTIAL);
+        }
+        // The mapping keeps the file referenced
+        close(fd);
+        mapped = true;
+        return true;
+    }
+
+    void FileSource::Impl::Unmap() {
+        if (base != nullptr)
+            munmap(const_cast<uint8_t *>(base), size);
+        base = nullptr;
+    }
+#endif
+
+    void FileSource::Impl::AdoptStream(std::FILE *opened) {
+        stream = opened;
+        ownsStream = true;
+    }
+
+    void FileSource::Impl::StartReader() {
+        // Map() may already have opened a pipe or device
+        if (stream == nullptr && path == "-") {
+            stream = stdin;
+        } else if (stream == nullptr) {
+            stream = std::fopen(path.c_str(), "rb");
+            if (stream == nullptr)
+                throw std::runtime_error("Cannot open input file: " + path);
+            ownsStream = true;
+        }
+        // Reads go straight into the aligned buffers
+        std::setvbuf(stream, nullptr, _IONBF, 0);
+        buffers[0] = MakeBuffer(BLOCK_SIZE);
+        buffers[1] = MakeBuffer(BLOCK_SIZE);
+        reader = std::thread([this] { ReadLoop(); });
+    }
+
+    void FileSource::Impl::ReadLoop() {
+        for (size_t slot = 0;; slot ^= 1) {
+            {
+                std::unique_lock lock(mutex);
+                changed.wait(lock, [&] { return stopping || !ready[slot]; });
+                if (stopping)
+                    return;
+            }
+            const size_t got =
+                    std::fread(buffers[slot].get(), 1, BLOCK_SIZE, stream);
+            const bool error = got < BLOCK_SIZE && std::ferror(stream) != 0;
+            {
+                std::lock_guard lock(mutex);
+                filled[slot] = error ? 0 : got;
+                ready[slot] = true;
+                failed = error;
+            }
+            changed.notify_all();
+            // An empty block marks the end for the consumer
+            if (got == 0 || error)
+                return;
+        }
+    }
+
+    FileSource::FileSource(const std::string &path, Access access)
+        : impl(std::make_unique<Impl>()) {
+        impl->path = path;
+        impl->access = access;
+        if (path == "-" || !impl->Map())
+            impl->StartReader();
+    }
+
+    FileSource::~FileSource() {
+        if (impl->reader.joinable()) {
+            {
+                std::lock_guard lock(impl->mutex);
+                impl->stopping = true;
+            }
+            impl->changed.notify_all();
+            impl->reader.join();
+        }
+        if (impl->ownsStream)
+            std::fclose(impl->stream);
+        impl->Unmap();
+    }
+
+    std::span<const uint8_t> FileSource::Next() {
+        Impl &state = *impl;
+        if (state.mapped) {
+            const size_t length =
+                    std::min(BLOCK_SIZE, state.size - state.offset);
+            const uint8_t *block = state.base + state.offset;
+            state.offset += length;
+#if !defined(_WIN32)
+            // Fault in the following block while this one is processed;
+            // offsets are multiples of BLOCK_SIZE and so page-aligned
+            if (state.offset < state.size)
+                madvise(const_cast<uint8_t *>(state.base + state.offset),
+                        std::min(BLOCK_SIZE, state.size - state.offset),
+                        MADV_WILLNEED);
+#endif
+            return {block, length};
+        }
+
+        std::unique_lock lock(state.mutex);
+        if (state.holding) {
+            // Hand the previous buffer back to the reader
+            state.ready[state.current] = false;
+            state.current ^= 1;
+            state.holding = false;
+            state.changed.notify_all();
+        }
+        state.changed.wait(lock, [&] { return state.ready[state.current]; });
+        if (state.failed)
+            throw std::runtime_error("Failed to read input file: " +
+                                     state.path);
+        const size_t length = state.filled[state.current];
+        if (length == 0)
+            return {};
+        state.holding = true;
+        return {state.buffers[state.current].get(), length};
+    }
+
+    bool FileSource::IsMapped() const {
+        return impl->mapped;
+    }
+} // namespace CryptoToysPP::Algorithm::Common
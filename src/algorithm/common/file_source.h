@@ -0,0 +1,82 @@
+/* clang-format off */
+/*
+ * @file file_source.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef FILE_SOURCE_H
+#define FILE_SOURCE_H
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+namespace CryptoToysPP::Algorithm::Common {
+    // Read-only, front-to-back access to a file in large blocks. Regular
+    // files are memory-mapped and the kernel is asked to fault in the
+    // next block while the current one is processed. Pipes, devices,
+    // stdin ("-") and files that cannot be mapped are read with large
+    // aligned reads on a background thread that stays one block ahead of
+    // the consumer (double buffering). Not thread-safe.
+    //
+    // A mapped file that another process truncates while it is read
+    // raises SIGBUS, which kills the process. Long-lived processes that
+    // read files they do not control (logs being rotated, downloads still
+    // being written) should use Access::READ.
+    class FileSource {
+    public:
+        static constexpr size_t BLOCK_SIZE = 4 * 1024 * 1024;
+
+        enum class Access {
+            MAP, // Map regular files, read everything else
+            READ // Always read through the background thread
+        };
+
+        // Throws std::runtime_error if the file cannot be opened
+        explicit FileSource(const std::string &path,
+                            Access access = Access::MAP);
+
+        // Waits for a pending background read to finish
+        ~FileSource();
+
+        FileSource(const FileSource &) = delete;
+
+        FileSource &operator=(const FileSource &) = delete;
+
+        // The next block of up to BLOCK_SIZE bytes, empty at the end of
+        // the file. The data stays valid until the next call. Throws
+        // std::runtime_error on a read error.
+        std::span<const uint8_t> Next();
+
+        // True when the file is read through a memory mapping
+        [[nodiscard]] bool IsMapped() const;
+
+    private:
+        struct Impl;
+
+        std::unique_ptr<Impl> impl;
+    };
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // FILE_SOURCE_H
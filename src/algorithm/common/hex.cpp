@@ -0,0 +1,499 @@
+/* clang-format off */
+/*
+ * @file hex.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "hex.h"
+#include "cpu.h"
+#include <array>
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#endif
+namespace CryptoToysPP::Algorithm::Common {
+    namespace {
+        constexpr char UPPER_DIGITS[] = "0123456789ABCDEF";
+        constexpr char LOWER_DIGITS[] = "0123456789abcdef";
+        constexpr uint8_t INVALID_NIBBLE = 0xFF;
+
+        constexpr auto NIBBLE_TABLE = [] {
+            std::array<uint8_t, 256> table{};
+            table.fill(INVALID_NIBBLE);
+            for (uint8_t i = 0; i < 10; ++i)
+                table['0' + i] = i;
+            for (uint8_t i = 0; i < 6; ++i) {
+                table['A' + i] = 10 + i;
+                table['a' + i] = 10 + i;
+            }
+            return table;
+        }();
+
+        // Kernels process whole vector blocks from the front and return
+        // the input consumed. The separator kernels handle "hh" + separator
+        // groups, writing (encode) or requiring (decode) a separator after
+        // every byte, so the caller keeps the last byte for itself.
+        using EncodeKernel = size_t (*)(const uint8_t *,
+                                        size_t,
+                                        uint8_t *,
+                                        const char *);
+        using SeparatedEncodeKernel = size_t (*)(const uint8_t *,
+                                                 size_t,
+                                                 uint8_t *,
+                                                 const char *,
+                                                 char);
+        using DecodeKernel = size_t (*)(const uint8_t *, size_t, uint8_t *);
+        using SeparatedDecodeKernel = size_t (*)(const uint8_t *,
+                                                 size_t,
+                                                 uint8_t *,
+                                                 char);
+
+        size_t EncodeNone(const uint8_t *, size_t, uint8_t *, const char *) {
+            return 0;
+        }
+
+        size_t EncodeSeparatedNone(const uint8_t *, size_t, uint8_t *,
+                                   const char *, char) {
+            return 0;
+        }
+
+        size_t DecodeNone(const uint8_t *, size_t, uint8_t *) {
+            return 0;
+        }
+
+        size_t DecodeSeparatedNone(const uint8_t *, size_t, uint8_t *, char) {
+            return 0;
+        }
+
+#if defined(CRYPTOTOYSPP_X86)
+        // Shuffle controls between 16 bytes and the 48 characters of their
+        // "hh" + separator groups: output vector q, lane j is position
+        // p = 16q + j of byte p / 3
+        struct SeparatorMasks {
+            alignas(16) int8_t high[3][16]; // byte index for a high digit
+            alignas(16) int8_t low[3][16];  // byte index for a low digit
+            alignas(16) int8_t separator[3][16]; // -1 where it goes
+            // Inverse direction: position of byte b's characters within
+            // vector q, or -1
+            alignas(16) int8_t highAt[3][16];
+            alignas(16) int8_t lowAt[3][16];
+            alignas(16) int8_t separatorAt[3][16];
+        };
+
+        constexpr SeparatorMasks SEPARATOR_MASKS = [] {
+            SeparatorMasks masks{};
+            for (int q = 0; q < 3; ++q) {
+                for (int j = 0; j < 16; ++j) {
+                    const int p = 16 * q + j;
+                    const int b = p / 3, r = p % 3;
+                    masks.high[q][j] = static_cast<int8_t>(r == 0 ? b : -1);
+                    masks.low[q][j] = static_cast<int8_t>(r == 1 ? b : -1);
+                    masks.separator[q][j] = static_cast<int8_t>(r == 2 ? -1 : 0);
+                }
+                for (int b = 0; b < 16; ++b) {
+                    auto at = [&](int p) {
+                        p -= 16 * q;
+                        return static_cast<int8_t>(p >= 0 && p < 16 ? p : -1);
+                    };
+                    masks.highAt[q][b] = at(3 * b);
+                    masks.lowAt[q][b] = at(3 * b + 1);
+                    masks.separatorAt[q][b] = at(3 * b + 2);
+                }
+            }
+            return masks;
+        }();
+
+        inline const __m128i *Mask(const int8_t *row) {
+            return reinterpret_cast<const __m128i *>(row);
+        }
+
+        // ---- SSE4.1: 16 bytes <-> 32 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline void EncodeDigits(__m128i in,
+                                 __m128i digits,
+                                 __m128i &high,
+                                 __m128i &low) {
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            high = _mm_shuffle_epi8(
+                    digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+            low = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibble));
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSse41(const uint8_t *data,
+                           size_t len,
+                           uint8_t *out,
+                           const char *digits) {
+            const __m128i table =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(digits));
+            size_t i = 0;
+            for (; len - i >= 16; i += 16, out += 32) {
+                __m128i high, low;
+                EncodeDigits(_mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(
+                                             data + i)),
+                             table, high, low);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                                 _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                                 _mm_unpackhi_epi8(high, low));
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t EncodeSeparatedSse41(const uint8_t *data,
+                                    size_t len,
+                                    uint8_t *out,
+                                    const char *digits,
+                                    char separator) {
+            const __m128i table =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(digits));
+            const __m128i fill = _mm_set1_epi8(separator);
+            size_t i = 0;
+            for (; len - i > 16; i += 16, out += 48) {
+                __m128i high, low;
+                EncodeDigits(_mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(
+                                             data + i)),
+                             table, high, low);
+                for (int q = 0; q < 3; ++q) {
+                    const __m128i chars = _mm_or_si128(
+                            _mm_or_si128(
+                                    _mm_shuffle_epi8(
+                                            high,
+                                            _mm_load_si128(Mask(
+                                                    SEPARATOR_MASKS.high[q]))),
+                                    _mm_shuffle_epi8(
+                                            low,
+                                            _mm_load_si128(Mask(
+                                                    SEPARATOR_MASKS.low[q])))),
+                            _mm_and_si128(fill,
+                                          _mm_load_si128(Mask(
+                                                  SEPARATOR_MASKS
+                                                          .separator[q]))));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16 * q),
+                                     chars);
+                }
+            }
+            return i;
+        }
+
+        // Digit characters to nibble values; `valid` collects the lanes
+        // holding one of 0-9, A-F, a-f
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        inline __m128i DecodeNibbles(__m128i chars, __m128i &valid) {
+            const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+            const __m128i isDigit = _mm_cmpeq_epi8(
+                    _mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+            const __m128i letter =
+                    _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                 _mm_set1_epi8('a'));
+            const __m128i isLetter = _mm_cmpeq_epi8(
+                    _mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+            valid = _mm_and_si128(valid, _mm_or_si128(isDigit, isLetter));
+            return _mm_blendv_epi8(_mm_add_epi8(letter, _mm_set1_epi8(10)),
+                                   digit, isDigit);
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSse41(const uint8_t *data, size_t len, uint8_t *out) {
+            const __m128i weights = _mm_set1_epi16(0x0110);
+            size_t i = 0;
+            for (; len - i >= 32; i += 32, out += 16) {
+                __m128i valid = _mm_set1_epi8(-1);
+                const __m128i first = DecodeNibbles(
+                        _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(data + i)),
+                        valid);
+                const __m128i second = DecodeNibbles(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                data + i + 16)),
+                        valid);
+                if (_mm_movemask_epi8(valid) != 0xFFFF)
+                    break;
+                _mm_storeu_si128(
+                        reinterpret_cast<__m128i *>(out),
+                        _mm_packus_epi16(_mm_maddubs_epi16(first, weights),
+                                         _mm_maddubs_epi16(second, weights)));
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        size_t DecodeSeparatedSse41(const uint8_t *data,
+                                    size_t len,
+                                    uint8_t *out,
+                                    char separator) {
+            const __m128i expected = _mm_set1_epi8(separator);
+            size_t i = 0;
+            for (; len - i >= 48; i += 48, out += 16) {
+                __m128i high = _mm_setzero_si128();
+                __m128i low = _mm_setzero_si128();
+                __m128i separators = _mm_setzero_si128();
+                for (int q = 0; q < 3; ++q) {
+                    const __m128i chars = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(data + i +
+                                                              16 * q));
+                    high = _mm_or_si128(
+                            high,
+                            _mm_shuffle_epi8(chars,
+                                             _mm_load_si128(Mask(
+                                                     SEPARATOR_MASKS
+                                                             .highAt[q]))));
+                    low = _mm_or_si128(
+                            low,
+                            _mm_shuffle_epi8(chars,
+                                             _mm_load_si128(Mask(
+                                                     SEPARATOR_MASKS
+                                                             .lowAt[q]))));
+                    separators = _mm_or_si128(
+                            separators,
+                            _mm_shuffle_epi8(chars,
+                                             _mm_load_si128(Mask(
+                                                     SEPARATOR_MASKS
+                                                             .separatorAt[q]))));
+                }
+                __m128i valid = _mm_cmpeq_epi8(separators, expected);
+                const __m128i highValues = DecodeNibbles(high, valid);
+                const __m128i lowValues = DecodeNibbles(low, valid);
+                if (_mm_movemask_epi8(valid) != 0xFFFF)
+                    break;
+                _mm_storeu_si128(
+                        reinterpret_cast<__m128i *>(out),
+                        _mm_or_si128(_mm_slli_epi16(highValues, 4), lowValues));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 32 bytes <-> 64 characters per step ----
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t EncodeAvx2(const uint8_t *data,
+                          size_t len,
+                          uint8_t *out,
+                          const char *digits) {
+            const __m256i table = _mm256_broadcastsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(digits)));
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            size_t i = 0;
+            for (; len - i >= 32; i += 32, out += 64) {
+                const __m256i in = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i *>(data + i));
+                const __m256i high = _mm256_shuffle_epi8(
+                        table,
+                        _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+                const __m256i low =
+                        _mm256_shuffle_epi8(table, _mm256_and_si256(in, nibble));
+                // Unpacking works per 128-bit lane: bytes 0-7 and 16-23
+                // end up in `first`, 8-15 and 24-31 in `second`
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+                _mm256_storeu_si256(
+                        reinterpret_cast<__m256i *>(out),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(
+                        reinterpret_cast<__m256i *>(out + 32),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return i;
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        inline __m256i DecodeNibbles(__m256i chars, __m256i &valid) {
+            const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+            const __m256i isDigit = _mm256_cmpeq_epi8(
+                    _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+            const __m256i letter = _mm256_sub_epi8(
+                    _mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+                    _mm256_set1_epi8('a'));
+            const __m256i isLetter = _mm256_cmpeq_epi8(
+                    _mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+            valid = _mm256_and_si256(valid, _mm256_or_si256(isDigit, isLetter));
+            return _mm256_blendv_epi8(
+                    _mm256_add_epi8(letter, _mm256_set1_epi8(10)), digit,
+                    isDigit);
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        size_t DecodeAvx2(const uint8_t *data, size_t len, uint8_t *out) {
+            const __m256i weights = _mm256_set1_epi16(0x0110);
+            size_t i = 0;
+            for (; len - i >= 64; i += 64, out += 32) {
+                __m256i valid = _mm256_set1_epi8(-1);
+                const __m256i first = DecodeNibbles(
+                        _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(data + i)),
+                        valid);
+                const __m256i second = DecodeNibbles(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                data + i + 32)),
+                        valid);
+                if (_mm256_movemask_epi8(valid) != -1)
+                    break;
+                // Packing is per lane too; restore the qword order
+                const __m256i bytes = _mm256_packus_epi16(
+                        _mm256_maddubs_epi16(first, weights),
+                        _mm256_maddubs_epi16(second, weights));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                                    _mm256_permute4x64_epi64(bytes, 0xD8));
+            }
+            return i;
+        }
+#endif
+
+        struct Kernels {
+            EncodeKernel encode = EncodeNone;
+            SeparatedEncodeKernel encodeSeparated = EncodeSeparatedNone;
+            DecodeKernel decode = DecodeNone;
+            SeparatedDecodeKernel decodeSeparated = DecodeSeparatedNone;
+        };
+
+        // Separated forms only have a 128-bit kernel
+        Kernels SelectKernels() {
+            Kernels kernels;
+            const auto &features = GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.sse41) {
+                kernels.encode = EncodeSse41;
+                kernels.encodeSeparated = EncodeSeparatedSse41;
+                kernels.decode = DecodeSse41;
+                kernels.decodeSeparated = DecodeSeparatedSse41;
+            }
+            if (features.avx2) {
+                kernels.encode = EncodeAvx2;
+                kernels.decode = DecodeAvx2;
+            }
+#endif
+            (void) features;
+            return kernels;
+        }
+
+        const Kernels &ActiveKernels() {
+            static const Kernels kernels = SelectKernels();
+            return kernels;
+        }
+    } // namespace
+
+    void HexEncode(std::span<const uint8_t> in,
+                   uint8_t *out,
+                   HexCase letterCase,
+                   char separator) {
+        const char *digits =
+                letterCase == HexCase::UPPER ? UPPER_DIGITS : LOWER_DIGITS;
+        const uint8_t *data = in.data();
+        const size_t len = in.size();
+        const Kernels &kernels = ActiveKernels();
+
+        if (separator == 0) {
+            size_t i = kernels.encode(data, len, out, digits);
+            for (out += i * 2; i < len; ++i) {
+                *out++ = digits[data[i] >> 4];
+                *out++ = digits[data[i] & 0x0F];
+            }
+            return;
+        }
+
+        size_t i = kernels.encodeSeparated(data, len, out, digits, separator);
+        for (out += i * 3; i < len; ++i) {
+            *out++ = digits[data[i] >> 4];
+            *out++ = digits[data[i] & 0x0F];
+            if (i + 1 < len)
+                *out++ = separator;
+        }
+    }
+
+    std::string HexEncode(std::span<const uint8_t> in,
+                          HexCase letterCase,
+                          char separator) {
+        std::string hex(HexEncodedSize(in.size(), separator), '\0');
+        HexEncode(in, reinterpret_cast<uint8_t *>(hex.data()), letterCase,
+                  separator);
+        return hex;
+    }
+
+    std::optional<size_t> HexDecode(std::span<const uint8_t> in,
+                                    uint8_t *out,
+                                    char separator) {
+        const uint8_t *data = in.data();
+        const size_t len = in.size();
+        const Kernels &kernels = ActiveKernels();
+        uint8_t *const begin = out;
+
+        if (separator == 0) {
+            if (len % 2 != 0)
+                return std::nullopt;
+            size_t i = kernels.decode(data, len, out);
+            for (out += i / 2; i < len; i += 2) {
+                const uint8_t hi = NIBBLE_TABLE[data[i]];
+                const uint8_t lo = NIBBLE_TABLE[data[i + 1]];
+                if (((hi | lo) & 0xF0) != 0)
+                    return std::nullopt;
+                *out++ = static_cast<uint8_t>((hi << 4) | lo);
+            }
+            return static_cast<size_t>(out - begin);
+        }
+
+        // Separators may follow a complete byte only, never two in a row
+        // and never at either end. The kernel only stops early on invalid
+        // input, which the scalar loop then reports within a block.
+        const auto mark = static_cast<uint8_t>(separator);
+        size_t i = kernels.decodeSeparated(data, len, out, separator);
+        out += i / 3;
+        bool afterSeparator = i != 0;
+        while (i < len) {
+            if (data[i] == mark) {
+                if (out == begin || afterSeparator)
+                    return std::nullopt;
+                afterSeparator = true;
+                ++i;
+                continue;
+            }
+            if (len - i < 2)
+                return std::nullopt;
+            const uint8_t hi = NIBBLE_TABLE[data[i]];
+            const uint8_t lo = NIBBLE_TABLE[data[i + 1]];
+            if (((hi | lo) & 0xF0) != 0)
+                return std::nullopt;
+            *out++ = static_cast<uint8_t>((hi << 4) | lo);
+            afterSeparator = false;
+            i += 2;
+        }
+        if (afterSeparator)
+            return std::nullopt;
+        return static_cast<size_t>(out - begin);
+    }
+
+    std::optional<std::string> HexDecode(std::string_view in, char separator) {
+        std::string bytes(in.size() / 2, '\0');
+        const std::optional<size_t> written =
+                HexDecode(std::span(reinterpret_cast<const uint8_t *>(in.data()),
+                                    in.size()),
+                          reinterpret_cast<uint8_t *>(bytes.data()), separator);
+        if (!written)
+            return std::nullopt;
+        bytes.resize(*written);
+        return bytes;
+    }
+} // namespace CryptoToysPP::Algorithm::Common
@@ -0,0 +1,74 @@
+/* clang-format off */
+/*
+ * @file hex.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef HEX_H
+#define HEX_H
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+namespace CryptoToysPP::Algorithm::Common {
+    // Hex engine shared by Base16, the AES key/IV and ciphertext encoding
+    // and the digest output. Whole vector blocks go through SSE4.1/AVX2
+    // kernels picked at runtime; the rest is scalar.
+    enum class HexCase { UPPER, LOWER };
+
+    // Characters HexEncode writes for `size` bytes; `separator` (0 for
+    // none) goes between every two bytes
+    constexpr size_t HexEncodedSize(size_t size, char separator = 0) {
+        if (size == 0)
+            return 0;
+        return separator == 0 ? size * 2 : size * 3 - 1;
+    }
+
+    // Write `in` to `out`, which must hold HexEncodedSize(in.size(),
+    // separator) bytes
+    void HexEncode(std::span<const uint8_t> in,
+                   uint8_t *out,
+                   HexCase letterCase = HexCase::UPPER,
+                   char separator = 0);
+
+    std::string HexEncode(std::span<const uint8_t> in,
+                          HexCase letterCase = HexCase::UPPER,
+                          char separator = 0);
+
+    // Decode digits of either case into `out`, which needs in.size() / 2
+    // bytes. With a separator (not itself a hex digit), a single one may
+    // follow any byte but the last, as in "de:ad:be:ef". Returns the bytes
+    // written, or std::nullopt for an odd digit count or any other
+    // character.
+    std::optional<size_t> HexDecode(std::span<const uint8_t> in,
+                                    uint8_t *out,
+                                    char separator = 0);
+
+    std::optional<std::string> HexDecode(std::string_view in,
+                                         char separator = 0);
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // HEX_H
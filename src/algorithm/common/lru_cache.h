@@ -0,0 +1,143 @@
+/* clang-format off */
+/*
+ * @file lru_cache.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+namespace CryptoToysPP::Algorithm::Common {
+    // Fixed-capacity map that evicts the least recently used entry. It is not
+    // thread-safe; owners guard it with their own mutex. Evicted values are
+    // simply destroyed, so values holding secrets must wipe themselves.
+    template<typename Key,
+             typename Value,
+             typename Hash = std::hash<Key>,
+             typename KeyEqual = std::equal_to<Key>>
+    class LruCache {
+    public:
+        explicit LruCache(size_t capacity) : capacity(capacity) {
+        }
+
+        // Look up an entry and mark it most recently used
+        Value *Find(const Key &key) {
+            const auto it = index.find(key);
+            if (it == index.end())
+                return nullptr;
+            entries.splice(entries.begin(), entries, it->second);
+            return &it->second->second;
+        }
+
+        // Remove and return an entry, e.g. to use a stateful value exclusively
+        std::optional<Value> Take(const Key &key) {
+            const auto it = index.find(key);
+            if (it == index.end())
+                return std::nullopt;
+            std::optional<Value> value(std::move(it->second->second));
+            entries.erase(it->second);
+            index.erase(it);
+            return value;
+        }
+
+        // Remove and return the least recently used entry, e.g. to evict by
+        // a budget other than the entry count
+        std::optional<std::pair<Key, Value>> TakeLeastRecent() {
+            if (entries.empty())
+                return std::nullopt;
+            std::optional<std::pair<Key, Value>> entry(
+                    std::move(entries.back()));
+            index.erase(entry->first);
+            entries.pop_back();
+            return entry;
+        }
+
+        // Insert or replace an entry as most recently used
+        void Put(const Key &key, Value value) {
+            if (capacity == 0)
+                return;
+            const auto it = index.find(key);
+            if (it != index.end()) {
+                it->second->second = std::move(value);
+                entries.splice(entries.begin(), entries, it->second);
+                return;
+            }
+            entries.emplace_front(key, std::move(value));
+            index.emplace(key, entries.begin());
+            Trim();
+        }
+
+        bool Erase(const Key &key) {
+            const auto it = index.find(key);
+            if (it == index.end())
+                return false;
+            entries.erase(it->second);
+            index.erase(it);
+            return true;
+        }
+
+        void Clear() {
+            index.clear();
+            entries.clear();
+        }
+
+        void SetCapacity(size_t newCapacity) {
+            capacity = newCapacity;
+            Trim();
+        }
+
+        [[nodiscard]] size_t Size() const {
+            return entries.size();
+        }
+
+        [[nodiscard]] size_t Capacity() const {
+            return capacity;
+        }
+
+    private:
+        using Entry = std::pair<Key, Value>;
+
+        void Trim() {
+            while (entries.size() > capacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+        }
+
+        size_t capacity;
+        std::list<Entry> entries; // Front is the most recently used
+        std::unordered_map<Key,
+                           typename std::list<Entry>::iterator,
+                           Hash,
+                           KeyEqual>
+                index;
+    };
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // LRU_CACHE_H
@@ -0,0 +1,112 @@
+/* clang-format off */
+/*
+ * @file stream_codec.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef STREAM_CODEC_H
+#define STREAM_CODEC_H
+#include "byte_buffer.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Common {
+    // Allocating Update/Finish overloads shared by the codecs' stream
+    // encoders. Derived provides the span-based primitives
+    //
+    //     static size_t MaxUpdateSize(size_t size);
+    //     static constexpr size_t MAX_FINISH_SIZE;
+    //     size_t Update(std::span<const uint8_t> in, std::span<uint8_t> out);
+    //     size_t Finish(std::span<uint8_t> out);
+    //
+    // and re-exports these with `using StreamEncoderBase::Update;` (and
+    // Finish), since its own overloads hide them.
+    template<typename Derived>
+    class StreamEncoderBase {
+    public:
+        std::vector<uint8_t> Update(std::span<const uint8_t> in) {
+            return FillBuffer<std::vector<uint8_t>>(
+                    Derived::MaxUpdateSize(in.size()),
+                    [&](std::span<uint8_t> out) {
+                        return Self().Update(in, out);
+                    });
+        }
+
+        std::vector<uint8_t> Finish() {
+            return FillBuffer<std::vector<uint8_t>>(
+                    Derived::MAX_FINISH_SIZE, [&](std::span<uint8_t> out) {
+                        return Self().Finish(out);
+                    });
+        }
+
+    private:
+        Derived &Self() {
+            return static_cast<Derived &>(*this);
+        }
+    };
+
+    // Decoder counterpart of StreamEncoderBase; the primitives return
+    // std::optional<size_t> and std::nullopt once the input is malformed
+    template<typename Derived>
+    class StreamDecoderBase {
+    public:
+        std::optional<std::vector<uint8_t>>
+        Update(std::span<const uint8_t> in) {
+            return Collect(Derived::MaxUpdateSize(in.size()),
+                           [&](std::span<uint8_t> out) {
+                               return Self().Update(in, out);
+                           });
+        }
+
+        std::optional<std::vector<uint8_t>> Finish() {
+            return Collect(Derived::MAX_FINISH_SIZE,
+                           [&](std::span<uint8_t> out) {
+                               return Self().Finish(out);
+                           });
+        }
+
+    private:
+        template<typename Writer>
+        static std::optional<std::vector<uint8_t>> Collect(size_t bound,
+                                                           Writer &&writer) {
+            bool valid = true;
+            std::vector<uint8_t> buffer = FillBuffer<std::vector<uint8_t>>(
+                    bound, [&](std::span<uint8_t> out) {
+                        const std::optional<size_t> written = writer(out);
+                        valid = written.has_value();
+                        return written.value_or(0);
+                    });
+            if (!valid)
+                return std::nullopt;
+            return buffer;
+        }
+
+        Derived &Self() {
+            return static_cast<Derived &>(*this);
+        }
+    };
+} // namespace CryptoToysPP::Algorithm::Common
+
+#endif // STREAM_CODEC_H
@@ -0,0 +1,137 @@
+/* clang-format off */
+/*
+ * @file batch_hash.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "batch_hash.h"
+#include "batch_hash_simd.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/executor.h"
+#include "algorithm/common/hex.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <optional>
+namespace CryptoToysPP::Algorithm::Hash {
+    namespace {
+        // Batches from this many messages on are split across the shared
+        // executor, in pieces of PARALLEL_GRAIN messages
+        constexpr size_t PARALLEL_THRESHOLD = 16 * 1024;
+        constexpr size_t PARALLEL_GRAIN = 4 * 1024;
+
+        std::optional<Detail::BatchAlgorithm> BatchAlgorithmFor(
+                Hasher::Type type) {
+            switch (type) {
+                case Hasher::Type::MD5:
+                    return Detail::BatchAlgorithm::MD5;
+                case Hasher::Type::SHA1:
+                    return Detail::BatchAlgorithm::SHA1;
+                case Hasher::Type::SHA256:
+                    return Detail::BatchAlgorithm::SHA256;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        void ForEachRange(size_t count,
+                          const std::function<void(size_t, size_t)> &body) {
+            if (count < PARALLEL_THRESHOLD ||
+                Common::Executor::Shared().ThreadCount() < 2) {
+                body(0, count);
+                return;
+            }
+            Common::Executor::Shared().ParallelFor(count, PARALLEL_GRAIN,
+                                                   body);
+        }
+    } // namespace
+
+    bool HasBatchKernel(Hasher::Type type) {
+        return BatchAlgorithmFor(type).has_value() && Detail::BatchLanes() > 0;
+    }
+
+    void BatchDigest(Hasher::Type type,
+                     std::span<const std::string_view> messages,
+                     std::span<uint8_t> out) {
+        Hasher prototype(type);
+        const size_t digestSize = prototype.DigestSize();
+        Common::RequireCapacity(out, messages.size() * digestSize);
+
+        const auto algorithm = BatchAlgorithmFor(type);
+        if (!algorithm || Detail::BatchLanes() == 0) {
+            ForEachRange(messages.size(), [&](size_t begin, size_t end) {
+                Hasher hasher(prototype);
+                for (size_t i = begin; i < end; ++i) {
+                    const std::vector<uint8_t> digest =
+                            hasher.Update(messages[i]).Final();
+                    std::ranges::copy(digest, out.data() + i * digestSize);
+                }
+            });
+            return;
+        }
+
+        // A group of lanes runs as long as its longest message, so lanes
+        // are filled with messages of similar block counts
+        std::vector<size_t> order(messages.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::ranges::stable_sort(order, {}, [&](size_t i) {
+            return (messages[i].size() + 8) / 64;
+        });
+        std::vector<Detail::BatchMessage> batch(messages.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            const std::string_view message = messages[order[i]];
+            batch[i] = {reinterpret_cast<const uint8_t *>(message.data()),
+                        message.size(), out.data() + order[i] * digestSize};
+        }
+        ForEachRange(batch.size(), [&](size_t begin, size_t end) {
+            Detail::BatchHashGroups(*algorithm, batch.data() + begin,
+                                    end - begin);
+        });
+    }
+
+    std::vector<uint8_t>
+    BatchDigest(Hasher::Type type,
+                std::span<const std::string_view> messages) {
+        std::vector<uint8_t> out(messages.size() *
+                                 Hasher(type).DigestSize());
+        BatchDigest(type, messages, out);
+        return out;
+    }
+
+    std::vector<std::string>
+    BatchHexDigest(Hasher::Type type,
+                   std::span<const std::string_view> messages) {
+        const std::vector<uint8_t> packed = BatchDigest(type, messages);
+        std::vector<std::string> digests;
+        digests.reserve(messages.size());
+        const size_t digestSize = messages.empty()
+                ? 0
+                : packed.size() / messages.size();
+        for (size_t i = 0; i < messages.size(); ++i)
+            digests.push_back(Common::HexEncode(
+                    std::span(packed).subspan(i * digestSize, digestSize),
+                    Common::HexCase::LOWER));
+        return digests;
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
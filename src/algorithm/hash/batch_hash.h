@@ -0,0 +1,62 @@
+/* clang-format off */
+/*
+ * @file batch_hash.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BATCH_HASH_H
+#define BATCH_HASH_H
+#include "hasher.h"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    // Digests of many independent messages. MD5, SHA-1 and SHA-256 hash
+    // 4, 8 or 16 messages per vector (SSE4.1/NEON, AVX2, AVX-512) after
+    // sorting them by length; other digests, and CPUs without those
+    // kernels, reuse a single Hasher for every message. Large batches
+    // are split across the shared executor.
+
+    // True when `type` has a multi-lane kernel on this CPU
+    bool HasBatchKernel(Hasher::Type type);
+
+    // Digests packed back to back: message i's digest occupies
+    // out[i * n, (i + 1) * n) with n = Hasher(type).DigestSize(). `out`
+    // must hold messages.size() * n bytes (std::length_error otherwise).
+    void BatchDigest(Hasher::Type type,
+                     std::span<const std::string_view> messages,
+                     std::span<uint8_t> out);
+
+    std::vector<uint8_t> BatchDigest(Hasher::Type type,
+                                     std::span<const std::string_view> messages);
+
+    // Lowercase hex digest of each message
+    std::vector<std::string>
+    BatchHexDigest(Hasher::Type type,
+                   std::span<const std::string_view> messages);
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // BATCH_HASH_H
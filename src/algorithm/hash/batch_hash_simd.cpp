@@ -0,0 +1,737 @@
+/* clang-format off */
+/*
+ * @file batch_hash_simd.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "batch_hash_simd.h"
+#include "algorithm/common/cpu.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#if defined(CRYPTOTOYSPP_X86)
+#include <immintrin.h>
+#elif defined(CRYPTOTOYSPP_NEON)
+#include <arm_neon.h>
+#endif
+
+// The compression functions are written once against a lane type and
+// inlined into each target-specific entry point; GCC and Clang only
+// inline across target attributes into a caller marked flatten
+#if defined(CRYPTOTOYSPP_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CRYPTOTOYSPP_FLATTEN __attribute__((flatten))
+#else
+#define CRYPTOTOYSPP_FLATTEN
+#endif
+#if defined(CRYPTOTOYSPP_X86) && defined(__GNUC__) && !defined(__clang__)
+// Out-of-line template instances would pass vectors without the ISA
+// enabled; they are always inlined into the entry points instead
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace CryptoToysPP::Algorithm::Hash::Detail {
+    namespace {
+        // ---- Lane types: one 32-bit word of every message per vector ----
+
+#if defined(CRYPTOTOYSPP_X86)
+        struct Sse41Lanes {
+            using V = __m128i;
+            static constexpr size_t COUNT = 4;
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Set1(uint32_t x) {
+                return _mm_set1_epi32(static_cast<int>(x));
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Load(const uint32_t *p) {
+                return _mm_load_si128(reinterpret_cast<const __m128i *>(p));
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static void Store(uint32_t *p, V v) {
+                _mm_store_si128(reinterpret_cast<__m128i *>(p), v);
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Add(V a, V b) {
+                return _mm_add_epi32(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Xor(V a, V b) {
+                return _mm_xor_si128(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Or(V a, V b) {
+                return _mm_or_si128(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Not(V a) {
+                return _mm_xor_si128(a, _mm_set1_epi32(-1));
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Rotl(V v) {
+                return _mm_or_si128(_mm_slli_epi32(v, N),
+                                    _mm_srli_epi32(v, 32 - N));
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Shr(V v) {
+                return _mm_srli_epi32(v, N);
+            }
+
+            // x ? y : z, bitwise
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Ch(V x, V y, V z) {
+                return _mm_xor_si128(z, _mm_and_si128(x, _mm_xor_si128(y, z)));
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Maj(V x, V y, V z) {
+                return _mm_or_si128(_mm_and_si128(x, y),
+                                    _mm_and_si128(z, _mm_or_si128(x, y)));
+            }
+
+            CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+            static V Xor3(V x, V y, V z) {
+                return _mm_xor_si128(_mm_xor_si128(x, y), z);
+            }
+        };
+
+        struct Avx2Lanes {
+            using V = __m256i;
+            static constexpr size_t COUNT = 8;
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Set1(uint32_t x) {
+                return _mm256_set1_epi32(static_cast<int>(x));
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Load(const uint32_t *p) {
+                return _mm256_load_si256(reinterpret_cast<const __m256i *>(p));
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static void Store(uint32_t *p, V v) {
+                _mm256_store_si256(reinterpret_cast<__m256i *>(p), v);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Add(V a, V b) {
+                return _mm256_add_epi32(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Xor(V a, V b) {
+                return _mm256_xor_si256(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Or(V a, V b) {
+                return _mm256_or_si256(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Not(V a) {
+                return _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Rotl(V v) {
+                return _mm256_or_si256(_mm256_slli_epi32(v, N),
+                                       _mm256_srli_epi32(v, 32 - N));
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Shr(V v) {
+                return _mm256_srli_epi32(v, N);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Ch(V x, V y, V z) {
+                return _mm256_xor_si256(
+                        z, _mm256_and_si256(x, _mm256_xor_si256(y, z)));
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Maj(V x, V y, V z) {
+                return _mm256_or_si256(
+                        _mm256_and_si256(x, y),
+                        _mm256_and_si256(z, _mm256_or_si256(x, y)));
+            }
+
+            CRYPTOTOYSPP_TARGET("avx2")
+            static V Xor3(V x, V y, V z) {
+                return _mm256_xor_si256(_mm256_xor_si256(x, y), z);
+            }
+        };
+
+        // AVX-512F brings native rotates and three-input logic
+        struct Avx512Lanes {
+            using V = __m512i;
+            static constexpr size_t COUNT = 16;
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Set1(uint32_t x) {
+                return _mm512_set1_epi32(static_cast<int>(x));
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Load(const uint32_t *p) {
+                return _mm512_load_si512(p);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static void Store(uint32_t *p, V v) {
+                _mm512_store_si512(p, v);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Add(V a, V b) {
+                return _mm512_add_epi32(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Xor(V a, V b) {
+                return _mm512_xor_si512(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Or(V a, V b) {
+                return _mm512_or_si512(a, b);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Not(V a) {
+                return _mm512_ternarylogic_epi32(a, a, a, 0x55);
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Rotl(V v) {
+                return _mm512_maskz_rol_epi32(0xFFFF, v, N);
+            }
+
+            template<int N>
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Shr(V v) {
+                return _mm512_maskz_srli_epi32(0xFFFF, v, N);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Ch(V x, V y, V z) {
+                return _mm512_ternarylogic_epi32(x, y, z, 0xCA);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Maj(V x, V y, V z) {
+                return _mm512_ternarylogic_epi32(x, y, z, 0xE8);
+            }
+
+            CRYPTOTOYSPP_TARGET("avx512f")
+            static V Xor3(V x, V y, V z) {
+                return _mm512_ternarylogic_epi32(x, y, z, 0x96);
+            }
+        };
+#elif defined(CRYPTOTOYSPP_NEON)
+        struct NeonLanes {
+            using V = uint32x4_t;
+            static constexpr size_t COUNT = 4;
+
+            static V Set1(uint32_t x) {
+                return vdupq_n_u32(x);
+            }
+
+            static V Load(const uint32_t *p) {
+                return vld1q_u32(p);
+            }
+
+            static void Store(uint32_t *p, V v) {
+                vst1q_u32(p, v);
+            }
+
+            static V Add(V a, V b) {
+                return vaddq_u32(a, b);
+            }
+
+            static V Xor(V a, V b) {
+                return veorq_u32(a, b);
+            }
+
+            static V Or(V a, V b) {
+                return vorrq_u32(a, b);
+            }
+
+            static V Not(V a) {
+                return vmvnq_u32(a);
+            }
+
+            template<int N>
+            static V Rotl(V v) {
+                return vsriq_n_u32(vshlq_n_u32(v, N), v, 32 - N);
+            }
+
+            template<int N>
+            static V Shr(V v) {
+                return vshrq_n_u32(v, N);
+            }
+
+            static V Ch(V x, V y, V z) {
+                return vbslq_u32(x, y, z);
+            }
+
+            // Where x and y agree the result is y, elsewhere z
+            static V Maj(V x, V y, V z) {
+                return vbslq_u32(veorq_u32(x, y), z, y);
+            }
+
+            static V Xor3(V x, V y, V z) {
+                return veorq_u32(veorq_u32(x, y), z);
+            }
+        };
+#endif
+
+        // ---- Compression functions, generic over the lane type ----
+
+        // Word j of every lane's current block
+        template<typename L>
+        using BlockWords = uint32_t[16][L::COUNT];
+
+        struct Md5 {
+            static constexpr size_t STATE_WORDS = 4;
+            static constexpr bool BIG_ENDIAN_WORDS = false;
+            static constexpr uint32_t IV[4] = {0x67452301, 0xefcdab89,
+                                               0x98badcfe, 0x10325476};
+            static constexpr uint32_t K[64] = {
+                    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+                    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+                    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+                    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+                    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+                    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+                    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+                    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+                    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+                    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+                    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+                    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+                    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+                    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+                    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+                    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+            static constexpr int SHIFTS[16] = {7, 12, 17, 22, 5, 9,  14, 20,
+                                               4, 11, 16, 23, 6, 10, 15, 21};
+
+            static constexpr size_t MessageIndex(size_t i) {
+                if (i < 16)
+                    return i;
+                if (i < 32)
+                    return (5 * i + 1) % 16;
+                if (i < 48)
+                    return (3 * i + 5) % 16;
+                return 7 * i % 16;
+            }
+
+            // Instead of moving a..d around, step I works on rotated slots
+            template<typename L, size_t I>
+            static void Step(typename L::V *v, const typename L::V *m) {
+                constexpr size_t A = (64 - I) % 4;
+                constexpr size_t B = (65 - I) % 4;
+                constexpr size_t C = (66 - I) % 4;
+                constexpr size_t D = (67 - I) % 4;
+                typename L::V f;
+                if constexpr (I < 16)
+                    f = L::Ch(v[B], v[C], v[D]);
+                else if constexpr (I < 32)
+                    f = L::Ch(v[D], v[B], v[C]);
+                else if constexpr (I < 48)
+                    f = L::Xor3(v[B], v[C], v[D]);
+                else
+                    f = L::Xor(v[C], L::Or(v[B], L::Not(v[D])));
+                const auto sum = L::Add(
+                        L::Add(v[A], f),
+                        L::Add(m[MessageIndex(I)], L::Set1(K[I])));
+                v[A] = L::Add(
+                        v[B],
+                        L::template Rotl<SHIFTS[I / 16 * 4 + I % 4]>(sum));
+            }
+
+            template<typename L, size_t... I>
+            static void Steps(typename L::V *v,
+                              const typename L::V *m,
+                              std::index_sequence<I...>) {
+                (Step<L, I>(v, m), ...);
+            }
+
+            template<typename L>
+            static void Compress(typename L::V *state,
+                                 const BlockWords<L> &words) {
+                typename L::V m[16];
+                typename L::V v[STATE_WORDS];
+                for (size_t j = 0; j < 16; ++j)
+                    m[j] = L::Load(words[j]);
+                std::copy_n(state, STATE_WORDS, v);
+                Steps<L>(v, m, std::make_index_sequence<64>());
+                for (size_t j = 0; j < STATE_WORDS; ++j)
+                    state[j] = L::Add(state[j], v[j]);
+            }
+        };
+
+        struct Sha1 {
+            static constexpr size_t STATE_WORDS = 5;
+            static constexpr bool BIG_ENDIAN_WORDS = true;
+            static constexpr uint32_t IV[5] = {0x67452301, 0xEFCDAB89,
+                                               0x98BADCFE, 0x10325476,
+                                               0xC3D2E1F0};
+
+            template<typename L, size_t I>
+            static void Step(typename L::V *v, typename L::V *w) {
+                constexpr size_t A = (80 - I) % 5;
+                constexpr size_t B = (81 - I) % 5;
+                constexpr size_t C = (82 - I) % 5;
+                constexpr size_t D = (83 - I) % 5;
+                constexpr size_t E = (84 - I) % 5;
+                // The schedule is kept as a ring of the last 16 words
+                if constexpr (I >= 16)
+                    w[I % 16] = L::template Rotl<1>(
+                            L::Xor(L::Xor3(w[(I - 3) % 16], w[(I - 8) % 16],
+                                           w[(I - 14) % 16]),
+                                   w[I % 16]));
+                typename L::V f;
+                uint32_t k;
+                if constexpr (I < 20) {
+                    f = L::Ch(v[B], v[C], v[D]);
+                    k = 0x5A827999;
+                } else if constexpr (I < 40) {
+                    f = L::Xor3(v[B], v[C], v[D]);
+                    k = 0x6ED9EBA1;
+                } else if constexpr (I < 60) {
+                    f = L::Maj(v[B], v[C], v[D]);
+                    k = 0x8F1BBCDC;
+                } else {
+                    f = L::Xor3(v[B], v[C], v[D]);
+                    k = 0xCA62C1D6;
+                }
+                v[E] = L::Add(L::Add(v[E], L::template Rotl<5>(v[A])),
+                              L::Add(L::Add(f, L::Set1(k)), w[I % 16]));
+                v[B] = L::template Rotl<30>(v[B]);
+            }
+
+            template<typename L, size_t... I>
+            static void Steps(typename L::V *v,
+                              typename L::V *w,
+                              std::index_sequence<I...>) {
+                (Step<L, I>(v, w), ...);
+            }
+
+            template<typename L>
+            static void Compress(typename L::V *state,
+                                 const BlockWords<L> &words) {
+                typename L::V w[16];
+                typename L::V v[STATE_WORDS];
+                for (size_t j = 0; j < 16; ++j)
+                    w[j] = L::Load(words[j]);
+                std::copy_n(state, STATE_WORDS, v);
+                Steps<L>(v, w, std::make_index_sequence<80>());
+                for (size_t j = 0; j < STATE_WORDS; ++j)
+                    state[j] = L::Add(state[j], v[j]);
+            }
+        };
+
+        struct Sha256 {
+            static constexpr size_t STATE_WORDS = 8;
+            static constexpr bool BIG_ENDIAN_WORDS = true;
+            static constexpr uint32_t IV[8] = {
+                    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+            static constexpr uint32_t K[64] = {
+                    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+                    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+                    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+                    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+                    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+                    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+                    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+                    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+                    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+            // Rotations right by n are written as rotations left by 32 - n
+            template<typename L, size_t I>
+            static void Step(typename L::V *v, typename L::V *w) {
+                constexpr size_t A = (64 - I) % 8;
+                constexpr size_t B = (65 - I) % 8;
+                constexpr size_t C = (66 - I) % 8;
+                constexpr size_t D = (67 - I) % 8;
+                constexpr size_t E = (68 - I) % 8;
+                constexpr size_t F = (69 - I) % 8;
+                constexpr size_t G = (70 - I) % 8;
+                constexpr size_t H = (71 - I) % 8;
+                if constexpr (I >= 16) {
+                    const auto w2 = w[(I - 2) % 16];
+                    const auto w15 = w[(I - 15) % 16];
+                    const auto sigma1 = L::Xor3(L::template Rotl<15>(w2),
+                                                L::template Rotl<13>(w2),
+                                                L::template Shr<10>(w2));
+                    const auto sigma0 = L::Xor3(L::template Rotl<25>(w15),
+                                                L::template Rotl<14>(w15),
+                                                L::template Shr<3>(w15));
+                    w[I % 16] = L::Add(L::Add(w[I % 16], sigma1),
+                                       L::Add(w[(I - 7) % 16], sigma0));
+                }
+                const auto bigSigma1 = L::Xor3(L::template Rotl<26>(v[E]),
+                                               L::template Rotl<21>(v[E]),
+                                               L::template Rotl<7>(v[E]));
+                const auto bigSigma0 = L::Xor3(L::template Rotl<30>(v[A]),
+                                               L::template Rotl<19>(v[A]),
+                                               L::template Rotl<10>(v[A]));
+                const auto t1 = L::Add(
+                        L::Add(L::Add(v[H], bigSigma1),
+                               L::Ch(v[E], v[F], v[G])),
+                        L::Add(L::Set1(K[I]), w[I % 16]));
+                v[D] = L::Add(v[D], t1);
+                v[H] = L::Add(t1,
+                              L::Add(bigSigma0, L::Maj(v[A], v[B], v[C])));
+            }
+
+            template<typename L, size_t... I>
+            static void Steps(typename L::V *v,
+                              typename L::V *w,
+                              std::index_sequence<I...>) {
+                (Step<L, I>(v, w), ...);
+            }
+
+            template<typename L>
+            static void Compress(typename L::V *state,
+                                 const BlockWords<L> &words) {
+                typename L::V w[16];
+                typename L::V v[STATE_WORDS];
+                for (size_t j = 0; j < 16; ++j)
+                    w[j] = L::Load(words[j]);
+                std::copy_n(state, STATE_WORDS, v);
+                Steps<L>(v, w, std::make_index_sequence<64>());
+                for (size_t j = 0; j < STATE_WORDS; ++j)
+                    state[j] = L::Add(state[j], v[j]);
+            }
+        };
+
+        // ---- Message scheduling ----
+
+        template<bool BigEndian>
+        uint32_t LoadWord(const uint8_t *p) {
+            if constexpr (BigEndian)
+                return static_cast<uint32_t>(p[0]) << 24 |
+                        static_cast<uint32_t>(p[1]) << 16 |
+                        static_cast<uint32_t>(p[2]) << 8 | p[3];
+            return static_cast<uint32_t>(p[3]) << 24 |
+                    static_cast<uint32_t>(p[2]) << 16 |
+                    static_cast<uint32_t>(p[1]) << 8 | p[0];
+        }
+
+        template<bool BigEndian>
+        void StoreWord(uint8_t *p, uint32_t word) {
+            for (size_t i = 0; i < 4; ++i)
+                p[i] = static_cast<uint8_t>(
+                        word >> (BigEndian ? 24 - 8 * i : 8 * i));
+        }
+
+        // Up to L::COUNT messages side by side. Whole blocks are read in
+        // place; the padded tail (one or two blocks) is built per lane.
+        // Unused lanes repeat the last message, and lanes that finished
+        // keep rehashing their last block until the longest is done.
+        template<typename L, typename Digest>
+        void HashGroup(const BatchMessage *messages, size_t count) {
+            constexpr size_t LANES = L::COUNT;
+            constexpr bool BE = Digest::BIG_ENDIAN_WORDS;
+            alignas(64) uint8_t tails[LANES][128];
+            const uint8_t *data[LANES];
+            size_t full[LANES];
+            size_t blocks[LANES];
+            size_t longest = 0;
+
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                const BatchMessage &message =
+                        messages[std::min(lane, count - 1)];
+                const size_t rest = message.size % 64;
+                const size_t tailBlocks = rest + 9 > 64 ? 2 : 1;
+                data[lane] = message.data;
+                full[lane] = message.size / 64;
+                blocks[lane] = full[lane] + tailBlocks;
+                longest = std::max(longest, blocks[lane]);
+
+                uint8_t *tail = tails[lane];
+                std::memset(tail, 0, sizeof(tails[lane]));
+                if (rest > 0)
+                    std::memcpy(tail, message.data + full[lane] * 64, rest);
+                tail[rest] = 0x80;
+                const uint64_t bits = static_cast<uint64_t>(message.size) * 8;
+                uint8_t *length = tail + tailBlocks * 64 - 8;
+                for (size_t i = 0; i < 8; ++i)
+                    length[i] = static_cast<uint8_t>(
+                            bits >> (BE ? 56 - 8 * i : 8 * i));
+            }
+
+            typename L::V state[Digest::STATE_WORDS];
+            for (size_t j = 0; j < Digest::STATE_WORDS; ++j)
+                state[j] = L::Set1(Digest::IV[j]);
+
+            alignas(64) BlockWords<L> words;
+            alignas(64) uint32_t lanes[Digest::STATE_WORDS][LANES];
+            for (size_t k = 0; k < longest; ++k) {
+                for (size_t lane = 0; lane < LANES; ++lane) {
+                    const size_t block = std::min(k, blocks[lane] - 1);
+                    const uint8_t *p = block < full[lane]
+                            ? data[lane] + block * 64
+                            : tails[lane] + (block - full[lane]) * 64;
+                    for (size_t j = 0; j < 16; ++j)
+                        words[j][lane] = LoadWord<BE>(p + j * 4);
+                }
+                Digest::template Compress<L>(state, words);
+
+                bool finished = false;
+                for (size_t lane = 0; lane < count; ++lane)
+                    finished |= blocks[lane] == k + 1;
+                if (!finished)
+                    continue;
+                for (size_t j = 0; j < Digest::STATE_WORDS; ++j)
+                    L::Store(lanes[j], state[j]);
+                for (size_t lane = 0; lane < count; ++lane) {
+                    if (blocks[lane] != k + 1)
+                        continue;
+                    for (size_t j = 0; j < Digest::STATE_WORDS; ++j)
+                        StoreWord<BE>(messages[lane].digest + j * 4,
+                                      lanes[j][lane]);
+                }
+            }
+        }
+
+        template<typename L>
+        void HashGroups(BatchAlgorithm algorithm,
+                        const BatchMessage *messages,
+                        size_t count) {
+            for (size_t i = 0; i < count; i += L::COUNT) {
+                const size_t group = std::min(L::COUNT, count - i);
+                switch (algorithm) {
+                    case BatchAlgorithm::MD5:
+                        HashGroup<L, Md5>(messages + i, group);
+                        break;
+                    case BatchAlgorithm::SHA1:
+                        HashGroup<L, Sha1>(messages + i, group);
+                        break;
+                    case BatchAlgorithm::SHA256:
+                        HashGroup<L, Sha256>(messages + i, group);
+                        break;
+                }
+            }
+        }
+
+        using GroupsKernel = void (*)(BatchAlgorithm,
+                                      const BatchMessage *,
+                                      size_t);
+
+#if defined(CRYPTOTOYSPP_X86)
+        CRYPTOTOYSPP_TARGET("ssse3,sse4.1")
+        CRYPTOTOYSPP_FLATTEN
+        void GroupsSse41(BatchAlgorithm algorithm,
+                         const BatchMessage *messages,
+                         size_t count) {
+            HashGroups<Sse41Lanes>(algorithm, messages, count);
+        }
+
+        CRYPTOTOYSPP_TARGET("avx2")
+        CRYPTOTOYSPP_FLATTEN
+        void GroupsAvx2(BatchAlgorithm algorithm,
+                        const BatchMessage *messages,
+                        size_t count) {
+            HashGroups<Avx2Lanes>(algorithm, messages, count);
+        }
+
+        CRYPTOTOYSPP_TARGET("avx512f")
+        CRYPTOTOYSPP_FLATTEN
+        void GroupsAvx512(BatchAlgorithm algorithm,
+                          const BatchMessage *messages,
+                          size_t count) {
+            HashGroups<Avx512Lanes>(algorithm, messages, count);
+        }
+#elif defined(CRYPTOTOYSPP_NEON)
+        void GroupsNeon(BatchAlgorithm algorithm,
+                        const BatchMessage *messages,
+                        size_t count) {
+            HashGroups<NeonLanes>(algorithm, messages, count);
+        }
+#endif
+
+        struct GroupsSelection {
+            GroupsKernel kernel = nullptr;
+            size_t lanes = 0;
+        };
+
+        GroupsSelection SelectGroupsKernel() {
+            const auto &features = Common::GetCpuFeatures();
+#if defined(CRYPTOTOYSPP_X86)
+            if (features.avx512bw)
+                return {GroupsAvx512, Avx512Lanes::COUNT};
+            if (features.avx2)
+                return {GroupsAvx2, Avx2Lanes::COUNT};
+            if (features.sse41)
+                return {GroupsSse41, Sse41Lanes::COUNT};
+#elif defined(CRYPTOTOYSPP_NEON)
+            if (features.neon)
+                return {GroupsNeon, NeonLanes::COUNT};
+#endif
+            (void) features;
+            return {};
+        }
+
+        const GroupsSelection &Selection() {
+            static const GroupsSelection selection = SelectGroupsKernel();
+            return selection;
+        }
+    } // namespace
+
+    size_t BatchLanes() {
+        return Selection().lanes;
+    }
+
+    void BatchHashGroups(BatchAlgorithm algorithm,
+                         const BatchMessage *messages,
+                         size_t count) {
+        Selection().kernel(algorithm, messages, count);
+    }
+} // namespace CryptoToysPP::Algorithm::Hash::Detail
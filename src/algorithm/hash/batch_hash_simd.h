@@ -0,0 +1,55 @@
+/* clang-format off */
+/*
+ * @file batch_hash_simd.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef BATCH_HASH_SIMD_H
+#define BATCH_HASH_SIMD_H
+#include <cstddef>
+#include <cstdint>
+namespace CryptoToysPP::Algorithm::Hash::Detail {
+    // Digests with multi-lane kernels; all three use 64-byte blocks and
+    // 32-bit words, so every vector lane carries one message
+    enum class BatchAlgorithm { MD5, SHA1, SHA256 };
+
+    struct BatchMessage {
+        const uint8_t *data;
+        size_t size;
+        uint8_t *digest; // Receives the binary digest
+    };
+
+    // Messages hashed side by side by the widest available kernel (4, 8
+    // or 16), or 0 when there is none
+    size_t BatchLanes();
+
+    // Hash `count` messages in consecutive groups of BatchLanes(). A group
+    // runs for as many blocks as its longest message, so callers should
+    // order the messages by length. Requires BatchLanes() > 0.
+    void BatchHashGroups(BatchAlgorithm algorithm,
+                         const BatchMessage *messages,
+                         size_t count);
+} // namespace CryptoToysPP::Algorithm::Hash::Detail
+
+#endif // BATCH_HASH_SIMD_H
@@ -0,0 +1,56 @@
+/* clang-format off */
+/*
+ * @file file_hash.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "file_hash.h"
+#include "multi_hasher.h"
+#include <chrono>
+namespace CryptoToysPP::Algorithm::Hash {
+    FileDigests HashFile(const std::string &path,
+                         const std::vector<Hasher::Type> &types,
+                         Common::FileSource::Access access) {
+        MultiHasher hasher(types);
+        const auto start = std::chrono::steady_clock::now();
+        Common::FileSource source(path, access);
+        FileDigests result;
+        while (true) {
+            const std::span<const uint8_t> block = source.Next();
+            if (block.empty())
+                break;
+            hasher.Update(block);
+            result.bytes += block.size();
+        }
+        result.digests = hasher.FinalHex();
+        result.seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+        if (result.seconds > 0)
+            result.bytesPerSecond =
+                    static_cast<double>(result.bytes) / result.seconds;
+        result.mapped = source.IsMapped();
+        return result;
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
@@ -0,0 +1,54 @@
+/* clang-format off */
+/*
+ * @file file_hash.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef FILE_HASH_H
+#define FILE_HASH_H
+#include "hasher.h"
+#include "algorithm/common/file_source.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    struct FileDigests {
+        std::vector<std::string> digests; // Lowercase hex, in request order
+        uint64_t bytes = 0;
+        double seconds = 0;
+        double bytesPerSecond = 0;
+        bool mapped = false; // Read through a memory mapping
+    };
+
+    // Hash a file ("-" for stdin) with one or more digests in a single
+    // pass over Common::FileSource, so nothing beyond two blocks is held
+    // in memory and reading overlaps with hashing. Throws
+    // std::runtime_error for I/O errors.
+    FileDigests HashFile(const std::string &path,
+                         const std::vector<Hasher::Type> &types,
+                         Common::FileSource::Access access =
+                                 Common::FileSource::Access::MAP);
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // FILE_HASH_H
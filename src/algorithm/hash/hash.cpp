@@ -26,189 +26,101 @@
  */
 /* clang-format on */
 #include "hash.h"
-#define CRYPTOPP_ENABLE_NAMESPACE_WEAK 1
-#include <cryptopp/md2.h>
-#include <cryptopp/md4.h>
-#include <cryptopp/md5.h>
-#include <cryptopp/sha.h>
-#include <cryptopp/sha3.h>
-#include <cryptopp/hex.h>
-#include <cryptopp/filters.h>
+#include "hasher.h"
 namespace CryptoToysPP::Algorithm::Hash {
     std::string MD2(const std::string &data) {
-        CryptoPP::Weak1::MD2 hash;
-        std::string digest;
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::MD2, data);
     }
 
     std::string MD4(const std::string &data) {
-        CryptoPP::Weak1::MD4 hash;
-        std::string digest;
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::MD4, data);
     }
 
     std::string MD5(const std::string &data) {
-        CryptoPP::Weak1::MD5 hash;
-        std::string digest;
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::MD5, data);
     }
 
     std::string SHA1(const std::string &data) {
-        CryptoPP::SHA1 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA1, data);
     }
 
     std::string SHA224(const std::string &data) {
-        CryptoPP::SHA224 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA224, data);
     }
 
     std::string SHA256(const std::string &data) {
-        CryptoPP::SHA256 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA256, data);
     }
 
     std::string SHA384(const std::string &data) {
-        CryptoPP::SHA384 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA384, data);
     }
 
     std::string SHA512(const std::string &data) {
-        CryptoPP::SHA512 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA512, data);
     }
 
     std::string SHA3_224(const std::string &data) {
-        CryptoPP::SHA3_224 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA3_224, data);
     }
 
     std::string SHA3_256(const std::string &data) {
-        CryptoPP::SHA3_256 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA3_256, data);
     }
 
     std::string SHA3_384(const std::string &data) {
-        CryptoPP::SHA3_384 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA3_384, data);
     }
 
     std::string SHA3_512(const std::string &data) {
-        CryptoPP::SHA3_512 hash;
-        std::string digest;
-
-        CryptoPP::StringSource source(
-                data, true,
-                new CryptoPP::HashFilter(
-                        hash,
-                        new CryptoPP::HexEncoder(new CryptoPP::StringSink(
-                                                         digest),
-                                                 false // lowercase hex output
-                                                 )));
-        return digest;
+        return Hasher::HexDigest(Hasher::Type::SHA3_512, data);
+    }
+
+    std::string MD2(std::istream &input) {
+        return Hasher(Hasher::Type::MD2).Update(input).FinalHex();
+    }
+
+    std::string MD4(std::istream &input) {
+        return Hasher(Hasher::Type::MD4).Update(input).FinalHex();
+    }
+
+    std::string MD5(std::istream &input) {
+        return Hasher(Hasher::Type::MD5).Update(input).FinalHex();
+    }
+
+    std::string SHA1(std::istream &input) {
+        return Hasher(Hasher::Type::SHA1).Update(input).FinalHex();
+    }
+
+    std::string SHA224(std::istream &input) {
+        return Hasher(Hasher::Type::SHA224).Update(input).FinalHex();
+    }
+
+    std::string SHA256(std::istream &input) {
+        return Hasher(Hasher::Type::SHA256).Update(input).FinalHex();
+    }
+
+    std::string SHA384(std::istream &input) {
+        return Hasher(Hasher::Type::SHA384).Update(input).FinalHex();
+    }
+
+    std::string SHA512(std::istream &input) {
+        return Hasher(Hasher::Type::SHA512).Update(input).FinalHex();
+    }
+
+    std::string SHA3_224(std::istream &input) {
+        return Hasher(Hasher::Type::SHA3_224).Update(input).FinalHex();
+    }
+
+    std::string SHA3_256(std::istream &input) {
+        return Hasher(Hasher::Type::SHA3_256).Update(input).FinalHex();
+    }
+
+    std::string SHA3_384(std::istream &input) {
+        return Hasher(Hasher::Type::SHA3_384).Update(input).FinalHex();
+    }
+
+    std::string SHA3_512(std::istream &input) {
+        return Hasher(Hasher::Type::SHA3_512).Update(input).FinalHex();
     }
 } // namespace CryptoToysPP::Algorithm::Hash
@@ -27,6 +27,7 @@
 /* clang-format on */
 #ifndef HASH_H
 #define HASH_H
+#include <istream>
 #include <string>
 namespace CryptoToysPP::Algorithm::Hash {
     std::string MD2(const std::string &data);
@@ -52,6 +53,32 @@ namespace CryptoToysPP::Algorithm::Hash {
     std::string SHA3_384(const std::string &data);
 
     std::string SHA3_512(const std::string &data);
+
+    // Stream overloads: the input is consumed in fixed-size blocks, so memory
+    // use does not depend on the input length
+    std::string MD2(std::istream &input);
+
+    std::string MD4(std::istream &input);
+
+    std::string MD5(std::istream &input);
+
+    std::string SHA1(std::istream &input);
+
+    std::string SHA224(std::istream &input);
+
+    std::string SHA256(std::istream &input);
+
+    std::string SHA384(std::istream &input);
+
+    std::string SHA512(std::istream &input);
+
+    std::string SHA3_224(std::istream &input);
+
+    std::string SHA3_256(std::istream &input);
+
+    std::string SHA3_384(std::istream &input);
+
+    std::string SHA3_512(std::istream &input);
 } // namespace CryptoToysPP::Algorithm::Hash
 
 #endif // HASH_H
@@ -0,0 +1,238 @@
+/* clang-format off */
+/*
+ * @file hasher.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "hasher.h"
+#include "algorithm/common/hex.h"
+#define CRYPTOPP_ENABLE_NAMESPACE_WEAK 1
+#include <cryptopp/md2.h>
+#include <cryptopp/md4.h>
+#include <cryptopp/md5.h>
+#include <cryptopp/sha.h>
+#include <cryptopp/sha3.h>
+#include <stdexcept>
+#include <utility>
+namespace CryptoToysPP::Algorithm::Hash {
+    namespace Detail {
+        // Type-erased Crypto++ hash that can be copied with its state
+        class HashEngine {
+        public:
+            virtual ~HashEngine() = default;
+
+            virtual CryptoPP::HashTransformation &Get() = 0;
+
+            [[nodiscard]] virtual std::unique_ptr<HashEngine> Clone() const = 0;
+        };
+    } // namespace Detail
+
+    namespace {
+        template<typename HashType>
+        class TypedEngine final : public Detail::HashEngine {
+        public:
+            CryptoPP::HashTransformation &Get() override {
+                return hash;
+            }
+
+            [[nodiscard]] std::unique_ptr<HashEngine> Clone() const override {
+                return std::make_unique<TypedEngine>(*this);
+            }
+
+        private:
+            HashType hash;
+        };
+
+        std::unique_ptr<Detail::HashEngine> MakeEngine(Hasher::Type type) {
+            switch (type) {
+                case Hasher::Type::MD2:
+                    return std::make_unique<
+                            TypedEngine<CryptoPP::Weak1::MD2>>();
+                case Hasher::Type::MD4:
+                    return std::make_unique<
+                            TypedEngine<CryptoPP::Weak1::MD4>>();
+                case Hasher::Type::MD5:
+                    return std::make_unique<
+                            TypedEngine<CryptoPP::Weak1::MD5>>();
+                case Hasher::Type::SHA1:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA1>>();
+                case Hasher::Type::SHA224:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA224>>();
+                case Hasher::Type::SHA256:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA256>>();
+                case Hasher::Type::SHA384:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA384>>();
+                case Hasher::Type::SHA512:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA512>>();
+                case Hasher::Type::SHA3_224:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA3_224>>();
+                case Hasher::Type::SHA3_256:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA3_256>>();
+                case Hasher::Type::SHA3_384:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA3_384>>();
+                case Hasher::Type::SHA3_512:
+                    return std::make_unique<TypedEngine<CryptoPP::SHA3_512>>();
+                default:
+                    throw std::invalid_argument("Unsupported hash type");
+            }
+        }
+
+    } // namespace
+
+    Hasher::Type Hasher::StringToType(const std::string &name) {
+        if (name == "md2")
+            return Type::MD2;
+        if (name == "md4")
+            return Type::MD4;
+        if (name == "md5")
+            return Type::MD5;
+        if (name == "sha1")
+            return Type::SHA1;
+        if (name == "sha224")
+            return Type::SHA224;
+        if (name == "sha256")
+            return Type::SHA256;
+        if (name == "sha384")
+            return Type::SHA384;
+        if (name == "sha512")
+            return Type::SHA512;
+        if (name == "sha3-224")
+            return Type::SHA3_224;
+        if (name == "sha3-256")
+            return Type::SHA3_256;
+        if (name == "sha3-384")
+            return Type::SHA3_384;
+        if (name == "sha3-512")
+            return Type::SHA3_512;
+        return Type::UNKNOWN;
+    }
+
+    std::string Hasher::TypeToString(Type type) {
+        switch (type) {
+            case Type::MD2:
+                return "md2";
+            case Type::MD4:
+                return "md4";
+            case Type::MD5:
+                return "md5";
+            case Type::SHA1:
+                return "sha1";
+            case Type::SHA224:
+                return "sha224";
+            case Type::SHA256:
+                return "sha256";
+            case Type::SHA384:
+                return "sha384";
+            case Type::SHA512:
+                return "sha512";
+            case Type::SHA3_224:
+                return "sha3-224";
+            case Type::SHA3_256:
+                return "sha3-256";
+            case Type::SHA3_384:
+                return "sha3-384";
+            case Type::SHA3_512:
+                return "sha3-512";
+            default:
+                return "unknown";
+        }
+    }
+
+    Hasher::Hasher(Type type) : type(type), engine(MakeEngine(type)) {
+    }
+
+    Hasher::Hasher(const Hasher &other) :
+        type(other.type), engine(other.engine->Clone()) {
+    }
+
+    Hasher &Hasher::operator=(const Hasher &other) {
+        if (this != &other) {
+            type = other.type;
+            engine = other.engine->Clone();
+        }
+        return *this;
+    }
+
+    Hasher::Hasher(Hasher &&other) noexcept = default;
+
+    Hasher &Hasher::operator=(Hasher &&other) noexcept = default;
+
+    Hasher::~Hasher() = default;
+
+    Hasher &Hasher::Update(std::span<const uint8_t> data) {
+        if (!data.empty())
+            engine->Get().Update(data.data(), data.size());
+        return *this;
+    }
+
+    Hasher &Hasher::Update(std::string_view data) {
+        return Update(std::span(reinterpret_cast<const uint8_t *>(data.data()),
+                                data.size()));
+    }
+
+    Hasher &Hasher::Update(std::istream &input) {
+        std::vector<char> buffer(STREAM_BLOCK_SIZE);
+        while (input) {
+            input.read(buffer.data(), static_cast<std::streamsize>(
+                                              buffer.size()));
+            const auto got = static_cast<size_t>(input.gcount());
+            if (got == 0)
+                break;
+            Update(std::string_view(buffer.data(), got));
+        }
+        return *this;
+    }
+
+    std::vector<uint8_t> Hasher::Final() {
+        auto &hash = engine->Get();
+        std::vector<uint8_t> digest(hash.DigestSize());
+        hash.Final(digest.data()); // Final() also restarts the hash
+        return digest;
+    }
+
+    std::string Hasher::FinalHex() {
+        const std::vector<uint8_t> digest = Final();
+        return Common::HexEncode(digest, Common::HexCase::LOWER);
+    }
+
+    void Hasher::Reset() {
+        engine->Get().Restart();
+    }
+
+    Hasher::Type Hasher::GetType() const {
+        return type;
+    }
+
+    size_t Hasher::DigestSize() const {
+        return engine->Get().DigestSize();
+    }
+
+    size_t Hasher::BlockSize() const {
+        return engine->Get().BlockSize();
+    }
+
+    std::string Hasher::HexDigest(Type type, std::string_view data) {
+        return Hasher(type).Update(data).FinalHex();
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
@@ -0,0 +1,116 @@
+/* clang-format off */
+/*
+ * @file hasher.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef HASHER_H
+#define HASHER_H
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    namespace Detail {
+        class HashEngine;
+    } // namespace Detail
+
+    // Incremental digest: Update() any number of times, then Final() or
+    // FinalHex(). Finalizing resets the hasher so it can be reused. Copies
+    // are independent snapshots of the current state. Not thread-safe.
+    class Hasher {
+    public:
+        enum class Type {
+            MD2,
+            MD4,
+            MD5,
+            SHA1,
+            SHA224,
+            SHA256,
+            SHA384,
+            SHA512,
+            SHA3_224,
+            SHA3_256,
+            SHA3_384,
+            SHA3_512,
+            UNKNOWN
+        };
+
+        // Names as used by the routes and the CLI: "md5", "sha3-256", ...
+        static Type StringToType(const std::string &name);
+
+        static std::string TypeToString(Type type);
+
+        // Throws std::invalid_argument for Type::UNKNOWN
+        explicit Hasher(Type type);
+
+        Hasher(const Hasher &other);
+
+        Hasher &operator=(const Hasher &other);
+
+        Hasher(Hasher &&other) noexcept;
+
+        Hasher &operator=(Hasher &&other) noexcept;
+
+        ~Hasher();
+
+        Hasher &Update(std::span<const uint8_t> data);
+
+        Hasher &Update(std::string_view data);
+
+        // Consume the stream to its end in fixed-size blocks
+        Hasher &Update(std::istream &input);
+
+        // Binary digest; the hasher starts over afterwards
+        std::vector<uint8_t> Final();
+
+        // Lowercase hex digest; the hasher starts over afterwards
+        std::string FinalHex();
+
+        // Discard everything absorbed so far
+        void Reset();
+
+        [[nodiscard]] Type GetType() const;
+
+        [[nodiscard]] size_t DigestSize() const;
+
+        // Input block size of the compression function (rate for SHA-3)
+        [[nodiscard]] size_t BlockSize() const;
+
+        // One-shot helper: lowercase hex digest of `data`
+        static std::string HexDigest(Type type, std::string_view data);
+
+    private:
+        static constexpr size_t STREAM_BLOCK_SIZE = 64 * 1024;
+
+        Type type;
+        std::unique_ptr<Detail::HashEngine> engine;
+    };
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // HASHER_H
@@ -0,0 +1,248 @@
+/* clang-format off */
+/*
+ * @file hmac.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "hmac.h"
+#include "algorithm/common/byte_buffer.h"
+#include "algorithm/common/executor.h"
+#include "algorithm/common/hex.h"
+#include "algorithm/common/lru_cache.h"
+#include <algorithm>
+#include <functional>
+#include <mutex>
+namespace CryptoToysPP::Algorithm::Hash {
+    namespace {
+        constexpr uint8_t IPAD = 0x36;
+        constexpr uint8_t OPAD = 0x5c;
+
+        // A tag costs a few compressions, so batches go parallel much
+        // earlier than plain digests do
+        constexpr size_t PARALLEL_THRESHOLD = 4 * 1024;
+        constexpr size_t PARALLEL_GRAIN = 1024;
+
+        // Key material must not outlive its use; the volatile stores keep
+        // the compiler from dropping the wipe
+        void Wipe(std::vector<uint8_t> &buffer) {
+            volatile uint8_t *bytes = buffer.data();
+            for (size_t i = 0; i < buffer.size(); ++i)
+                bytes[i] = 0;
+        }
+
+        void ForEachRange(size_t count,
+                          const std::function<void(size_t, size_t)> &body) {
+            if (count < PARALLEL_THRESHOLD ||
+                Common::Executor::Shared().ThreadCount() < 2) {
+                body(0, count);
+                return;
+            }
+            Common::Executor::Shared().ParallelFor(count, PARALLEL_GRAIN,
+                                                   body);
+        }
+    } // namespace
+
+    // Hash states with the padded key absorbed; never modified after
+    // construction, so threads copy them concurrently
+    struct Hmac::KeyState {
+        Hasher inner;
+        Hasher outer;
+
+        // Write the tag of the message absorbed by `message` (a copy of
+        // `inner`) to `out` and restart `message` from `inner`
+        void Finish(Hasher &message, uint8_t *out) const {
+            const std::vector<uint8_t> innerDigest = message.Final();
+            const std::vector<uint8_t> tag =
+                    Hasher(outer).Update(innerDigest).Final();
+            std::ranges::copy(tag, out);
+            message = inner;
+        }
+    };
+
+    // Bounded LRU of key states, shared by all threads
+    struct Hmac::KeyCache {
+        std::mutex mutex;
+        Common::LruCache<std::string, std::shared_ptr<const KeyState>>
+                entries{KEY_CACHE_CAPACITY};
+    };
+
+    Hmac::KeyCache &Hmac::GetKeyCache() {
+        static KeyCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const Hmac::KeyState>
+    Hmac::AcquireKeyState(Hasher::Type type, std::span<const uint8_t> key) {
+        // Cache key: the hash type and a digest of the key, so the raw key
+        // itself is never kept as a map key
+        const std::vector<uint8_t> keyDigest =
+                Hasher(Hasher::Type::SHA256).Update(key).Final();
+        std::string cacheKey(1, static_cast<char>(type));
+        cacheKey.append(keyDigest.begin(), keyDigest.end());
+
+        auto &cache = GetKeyCache();
+        {
+            std::lock_guard lock(cache.mutex);
+            if (const auto *cached = cache.entries.Find(cacheKey))
+                return *cached;
+        }
+
+        // Keys longer than a block are hashed first; the result is padded
+        // with zeros to a full block
+        Hasher inner(type);
+        const size_t blockSize = inner.BlockSize();
+        std::vector<uint8_t> block(blockSize, 0);
+        if (key.size() > blockSize) {
+            std::vector<uint8_t> digest = Hasher(type).Update(key).Final();
+            std::ranges::copy(digest, block.begin());
+            Wipe(digest);
+        } else {
+            std::ranges::copy(key, block.begin());
+        }
+        for (auto &byte : block)
+            byte ^= IPAD;
+        inner.Update(block);
+        Hasher outer(type);
+        for (auto &byte : block)
+            byte ^= IPAD ^ OPAD;
+        outer.Update(block);
+        Wipe(block);
+
+        // A concurrent miss on the same key just computes it twice
+        auto state = std::make_shared<const KeyState>(
+                KeyState{std::move(inner), std::move(outer)});
+        std::lock_guard lock(cache.mutex);
+        cache.entries.Put(cacheKey, state);
+        return state;
+    }
+
+    void Hmac::ClearKeyCache() {
+        auto &cache = GetKeyCache();
+        std::lock_guard lock(cache.mutex);
+        cache.entries.Clear();
+    }
+
+    Hmac::Hmac(Hasher::Type type, std::span<const uint8_t> key) :
+        state(AcquireKeyState(type, key)), inner(state->inner) {
+    }
+
+    Hmac::Hmac(Hasher::Type type, std::string_view key) :
+        Hmac(type, Common::AsBytes(key)) {
+    }
+
+    Hmac &Hmac::Update(std::span<const uint8_t> data) {
+        inner.Update(data);
+        return *this;
+    }
+
+    Hmac &Hmac::Update(std::string_view data) {
+        inner.Update(data);
+        return *this;
+    }
+
+    Hmac &Hmac::Update(std::istream &input) {
+        inner.Update(input);
+        return *this;
+    }
+
+    std::vector<uint8_t> Hmac::Final() {
+        std::vector<uint8_t> tag(DigestSize());
+        state->Finish(inner, tag.data());
+        return tag;
+    }
+
+    std::string Hmac::FinalHex() {
+        return Common::HexEncode(Final(), Common::HexCase::LOWER);
+    }
+
+    void Hmac::Reset() {
+        inner = state->inner;
+    }
+
+    Hasher::Type Hmac::GetType() const {
+        return inner.GetType();
+    }
+
+    size_t Hmac::DigestSize() const {
+        return inner.DigestSize();
+    }
+
+    std::vector<uint8_t> Hmac::Digest(Hasher::Type type,
+                                      std::string_view key,
+                                      std::string_view message) {
+        return Hmac(type, key).Update(message).Final();
+    }
+
+    std::string Hmac::HexDigest(Hasher::Type type,
+                                std::string_view key,
+                                std::string_view message) {
+        return Hmac(type, key).Update(message).FinalHex();
+    }
+
+    void Hmac::BatchDigest(Hasher::Type type,
+                           std::string_view key,
+                           std::span<const std::string_view> messages,
+                           std::span<uint8_t> out) {
+        const std::shared_ptr<const KeyState> keyState =
+                AcquireKeyState(type, Common::AsBytes(key));
+        const size_t digestSize = keyState->inner.DigestSize();
+        Common::RequireCapacity(out, messages.size() * digestSize);
+        ForEachRange(messages.size(), [&](size_t begin, size_t end) {
+            Hasher message(keyState->inner);
+            for (size_t i = begin; i < end; ++i) {
+                message.Update(messages[i]);
+                keyState->Finish(message, out.data() + i * digestSize);
+            }
+        });
+    }
+
+    std::vector<std::string>
+    Hmac::BatchHexDigest(Hasher::Type type,
+                         std::string_view key,
+                         std::span<const std::string_view> messages) {
+        const size_t digestSize = Hasher(type).DigestSize();
+        std::vector<uint8_t> packed(messages.size() * digestSize);
+        BatchDigest(type, key, messages, packed);
+        std::vector<std::string> tags;
+        tags.reserve(messages.size());
+        for (size_t i = 0; i < messages.size(); ++i)
+            tags.push_back(Common::HexEncode(
+                    std::span(packed).subspan(i * digestSize, digestSize),
+                    Common::HexCase::LOWER));
+        return tags;
+    }
+
+    bool Hmac::Verify(Hasher::Type type,
+                      std::string_view key,
+                      std::string_view message,
+                      std::span<const uint8_t> tag) {
+        const std::vector<uint8_t> expected = Digest(type, key, message);
+        if (tag.size() != expected.size())
+            return false;
+        uint8_t difference = 0;
+        for (size_t i = 0; i < tag.size(); ++i)
+            difference |= static_cast<uint8_t>(tag[i] ^ expected[i]);
+        return difference == 0;
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
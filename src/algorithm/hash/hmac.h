@@ -0,0 +1,122 @@
+/* clang-format off */
+/*
+ * @file hmac.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef HMAC_H
+#define HMAC_H
+#include "hasher.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    // HMAC (RFC 2104) over any Hasher digest, with the sponge rate as the
+    // block size for SHA-3. The key is absorbed once:
+    // the hash states after the K ^ ipad and K ^ opad blocks are kept and
+    // copied for every message, so a tag costs the message blocks plus the
+    // two finalizations. Recently used keys keep those states in a bounded
+    // process-wide cache, which the static helpers share.
+    //
+    // An Hmac object is not thread-safe; the static helpers are.
+    class Hmac {
+    public:
+        static constexpr size_t KEY_CACHE_CAPACITY = 64;
+
+        // Throws std::invalid_argument for Type::UNKNOWN
+        Hmac(Hasher::Type type, std::span<const uint8_t> key);
+
+        Hmac(Hasher::Type type, std::string_view key);
+
+        Hmac &Update(std::span<const uint8_t> data);
+
+        Hmac &Update(std::string_view data);
+
+        // Consume the stream to its end
+        Hmac &Update(std::istream &input);
+
+        // Binary tag; the object starts over with the same key
+        std::vector<uint8_t> Final();
+
+        // Lowercase hex tag; the object starts over with the same key
+        std::string FinalHex();
+
+        // Discard the message absorbed so far, keeping the key
+        void Reset();
+
+        [[nodiscard]] Hasher::Type GetType() const;
+
+        [[nodiscard]] size_t DigestSize() const;
+
+        static std::vector<uint8_t> Digest(Hasher::Type type,
+                                           std::string_view key,
+                                           std::string_view message);
+
+        static std::string HexDigest(Hasher::Type type,
+                                     std::string_view key,
+                                     std::string_view message);
+
+        // Tags of many messages under one key, packed back to back as in
+        // BatchDigest: `out` must hold messages.size() * DigestSize()
+        // bytes (std::length_error otherwise). Large batches are split
+        // across the shared executor.
+        static void BatchDigest(Hasher::Type type,
+                                std::string_view key,
+                                std::span<const std::string_view> messages,
+                                std::span<uint8_t> out);
+
+        static std::vector<std::string>
+        BatchHexDigest(Hasher::Type type,
+                       std::string_view key,
+                       std::span<const std::string_view> messages);
+
+        // Compare `tag` with the tag of `message` in constant time
+        static bool Verify(Hasher::Type type,
+                           std::string_view key,
+                           std::string_view message,
+                           std::span<const uint8_t> tag);
+
+        static void ClearKeyCache();
+
+    private:
+        struct KeyState;
+        struct KeyCache;
+
+        static KeyCache &GetKeyCache();
+
+        // Cached pad states for (type, key), computed on a miss
+        static std::shared_ptr<const KeyState>
+        AcquireKeyState(Hasher::Type type, std::span<const uint8_t> key);
+
+        std::shared_ptr<const KeyState> state;
+        Hasher inner; // Inner hash of the current message
+    };
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // HMAC_H
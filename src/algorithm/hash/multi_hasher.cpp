@@ -0,0 +1,116 @@
+/* clang-format off */
+/*
+ * @file multi_hasher.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "multi_hasher.h"
+#include "algorithm/common/executor.h"
+#include <algorithm>
+#include <stdexcept>
+namespace CryptoToysPP::Algorithm::Hash {
+    MultiHasher::MultiHasher(const std::vector<Hasher::Type> &types) {
+        if (types.empty())
+            throw std::invalid_argument("No hash types selected");
+        hashers.reserve(types.size());
+        for (const auto type : types)
+            hashers.emplace_back(type);
+    }
+
+    MultiHasher &MultiHasher::Update(std::span<const uint8_t> data) {
+        if (hashers.size() > 1 && data.size() >= PARALLEL_THRESHOLD &&
+            Common::Executor::Shared().ThreadCount() > 1) {
+            // The hashers share nothing, so each can run on its own core;
+            // a slow one (SHA3-512, MD2) then bounds the time instead of
+            // the sum of all of them
+            Common::Executor::Shared().ParallelFor(
+                    hashers.size(), 1, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i)
+                            hashers[i].Update(data);
+                    });
+            return *this;
+        }
+        for (size_t offset = 0; offset < data.size();
+             offset += CACHE_BLOCK_SIZE) {
+            const auto block = data.subspan(
+                    offset, std::min(CACHE_BLOCK_SIZE, data.size() - offset));
+            for (auto &hasher : hashers)
+                hasher.Update(block);
+        }
+        return *this;
+    }
+
+    MultiHasher &MultiHasher::Update(std::string_view data) {
+        return Update(std::span(reinterpret_cast<const uint8_t *>(data.data()),
+                                data.size()));
+    }
+
+    MultiHasher &MultiHasher::Update(std::istream &input) {
+        std::vector<char> buffer(STREAM_BLOCK_SIZE);
+        while (input) {
+            input.read(buffer.data(), static_cast<std::streamsize>(
+                                              buffer.size()));
+            const auto got = static_cast<size_t>(input.gcount());
+            if (got == 0)
+                break;
+            Update(std::string_view(buffer.data(), got));
+        }
+        return *this;
+    }
+
+    std::vector<std::vector<uint8_t>> MultiHasher::Final() {
+        std::vector<std::vector<uint8_t>> digests;
+        digests.reserve(hashers.size());
+        for (auto &hasher : hashers)
+            digests.push_back(hasher.Final());
+        return digests;
+    }
+
+    std::vector<std::string> MultiHasher::FinalHex() {
+        std::vector<std::string> digests;
+        digests.reserve(hashers.size());
+        for (auto &hasher : hashers)
+            digests.push_back(hasher.FinalHex());
+        return digests;
+    }
+
+    void MultiHasher::Reset() {
+        for (auto &hasher : hashers)
+            hasher.Reset();
+    }
+
+    std::vector<Hasher::Type> MultiHasher::GetTypes() const {
+        std::vector<Hasher::Type> types;
+        types.reserve(hashers.size());
+        for (const auto &hasher : hashers)
+            types.push_back(hasher.GetType());
+        return types;
+    }
+
+    std::vector<std::string>
+    MultiHasher::HexDigests(const std::vector<Hasher::Type> &types,
+                            std::string_view data) {
+        return MultiHasher(types).Update(data).FinalHex();
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
@@ -0,0 +1,82 @@
+/* clang-format off */
+/*
+ * @file multi_hasher.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef MULTI_HASHER_H
+#define MULTI_HASHER_H
+#include "hasher.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    // Several digests of the same input in one pass. Small updates are
+    // fed to every hasher block by block, so each block is read from
+    // memory once and hashed while it is still in cache; large updates
+    // give each algorithm its own core on the shared executor. Digests
+    // come back in the order of the types passed to the constructor.
+    class MultiHasher {
+    public:
+        // Throws std::invalid_argument for an empty list or Type::UNKNOWN
+        explicit MultiHasher(const std::vector<Hasher::Type> &types);
+
+        MultiHasher &Update(std::span<const uint8_t> data);
+
+        MultiHasher &Update(std::string_view data);
+
+        // Consume the stream to its end in fixed-size blocks
+        MultiHasher &Update(std::istream &input);
+
+        // Binary digests; the hashers start over afterwards
+        std::vector<std::vector<uint8_t>> Final();
+
+        // Lowercase hex digests; the hashers start over afterwards
+        std::vector<std::string> FinalHex();
+
+        void Reset();
+
+        [[nodiscard]] std::vector<Hasher::Type> GetTypes() const;
+
+        // One-shot helper: lowercase hex digests of `data`
+        static std::vector<std::string>
+        HexDigests(const std::vector<Hasher::Type> &types,
+                   std::string_view data);
+
+    private:
+        // Sized to stay in L2 while every hasher passes over it
+        static constexpr size_t CACHE_BLOCK_SIZE = 32 * 1024;
+        // Updates from this size on run one hasher per core
+        static constexpr size_t PARALLEL_THRESHOLD = 1024 * 1024;
+        static constexpr size_t STREAM_BLOCK_SIZE = 4 * 1024 * 1024;
+
+        std::vector<Hasher> hashers;
+    };
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // MULTI_HASHER_H
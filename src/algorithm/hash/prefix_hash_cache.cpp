@@ -0,0 +1,112 @@
+/* clang-format off */
+/*
+ * @file prefix_hash_cache.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "prefix_hash_cache.h"
+#include <cstring>
+#include <functional>
+#include <optional>
+namespace CryptoToysPP::Algorithm::Hash {
+    PrefixHashCache::PrefixHashCache(size_t capacity, size_t byteBudget) :
+        capacity(capacity), byteBudget(byteBudget), entries(capacity) {
+    }
+
+    void PrefixHashCache::Evict(size_t size) {
+        while (entries.Size() > 0 &&
+               (entries.Size() >= capacity ||
+                cachedBytes + size > byteBudget)) {
+            const auto evicted = entries.TakeLeastRecent();
+            cachedBytes -= evicted->second.data.size();
+        }
+    }
+
+    std::string PrefixHashCache::HexDigest(Hasher::Type type,
+                                           std::string_view data) {
+        if (data.size() < MIN_CACHED_SIZE)
+            return Hasher::HexDigest(type, data);
+
+        const size_t fingerprint =
+                std::hash<std::string_view>{}(data.substr(0, CHECKPOINT_SIZE));
+        std::string key(1, static_cast<char>(type));
+        key.append(reinterpret_cast<const char *>(&fingerprint),
+                   sizeof(fingerprint));
+
+        // The entry is taken out while it is extended, so concurrent
+        // requests for the same input never share a Hasher
+        std::optional<Entry> cached;
+        {
+            std::lock_guard lock(mutex);
+            cached = entries.Take(key);
+            if (cached)
+                cachedBytes -= cached->data.size();
+        }
+        // An input over the budget would evict everything else; the stale
+        // entry taken above is dropped with it
+        if (data.size() > byteBudget || capacity == 0)
+            return Hasher::HexDigest(type, data);
+        Entry entry = cached ? std::move(*cached) : Entry{};
+
+        // Keep the checkpoints whose chunks are unchanged
+        size_t kept = 0;
+        while (kept < entry.checkpoints.size() &&
+               (kept + 1) * CHECKPOINT_SIZE <= data.size() &&
+               std::memcmp(entry.data.data() + kept * CHECKPOINT_SIZE,
+                           data.data() + kept * CHECKPOINT_SIZE,
+                           CHECKPOINT_SIZE) == 0)
+            ++kept;
+        entry.checkpoints.erase(entry.checkpoints.begin() +
+                                        static_cast<std::ptrdiff_t>(kept),
+                                entry.checkpoints.end());
+
+        Hasher hasher = kept > 0 ? entry.checkpoints.back() : Hasher(type);
+        size_t offset = kept * CHECKPOINT_SIZE;
+        entry.checkpoints.reserve(data.size() / CHECKPOINT_SIZE);
+        for (; data.size() - offset >= CHECKPOINT_SIZE;
+             offset += CHECKPOINT_SIZE) {
+            hasher.Update(data.substr(offset, CHECKPOINT_SIZE));
+            entry.checkpoints.push_back(hasher);
+        }
+        const std::string digest = hasher.Update(data.substr(offset))
+                                           .FinalHex();
+
+        entry.data.resize(kept * CHECKPOINT_SIZE);
+        entry.data.append(data.substr(kept * CHECKPOINT_SIZE));
+        std::lock_guard lock(mutex);
+        // A concurrent request for the same input may have stored its own
+        if (const auto replaced = entries.Take(key))
+            cachedBytes -= replaced->data.size();
+        Evict(entry.data.size());
+        cachedBytes += entry.data.size();
+        entries.Put(key, std::move(entry));
+        return digest;
+    }
+
+    void PrefixHashCache::Clear() {
+        std::lock_guard lock(mutex);
+        entries.Clear();
+        cachedBytes = 0;
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
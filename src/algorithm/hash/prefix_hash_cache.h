@@ -0,0 +1,86 @@
+/* clang-format off */
+/*
+ * @file prefix_hash_cache.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef PREFIX_HASH_CACHE_H
+#define PREFIX_HASH_CACHE_H
+#include "hasher.h"
+#include "algorithm/common/lru_cache.h"
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    // Digests of inputs that mostly extend earlier ones, such as a log
+    // pasted into the hash page and then typed into. Each cached input
+    // keeps the hash state at every CHECKPOINT_SIZE boundary; a new input
+    // that shares a prefix with it resumes from the last checkpoint inside
+    // that prefix, so an append costs only the new tail and a memcmp of
+    // the prefix. Entries are looked up by the hash type and a fingerprint
+    // of the first checkpoint's bytes, then checked byte for byte, so a
+    // fingerprint collision only costs a full rehash. The cache holds at
+    // most `capacity` inputs totalling `byteBudget` bytes, evicting the
+    // least recently used; larger inputs are hashed without caching.
+    // Thread-safe.
+    class PrefixHashCache {
+    public:
+        static constexpr size_t CHECKPOINT_SIZE = 64 * 1024;
+
+        // Shorter inputs are hashed directly and not cached
+        static constexpr size_t MIN_CACHED_SIZE = 4 * CHECKPOINT_SIZE;
+
+        static constexpr size_t DEFAULT_CAPACITY = 8;
+
+        static constexpr size_t DEFAULT_BYTE_BUDGET = size_t{64} << 20;
+
+        explicit PrefixHashCache(size_t capacity = DEFAULT_CAPACITY,
+                                 size_t byteBudget = DEFAULT_BYTE_BUDGET);
+
+        // Lowercase hex digest, the same as Hasher::HexDigest
+        std::string HexDigest(Hasher::Type type, std::string_view data);
+
+        void Clear();
+
+    private:
+        struct Entry {
+            std::string data;                // Input the states belong to
+            std::vector<Hasher> checkpoints; // [i] has absorbed i + 1 chunks
+        };
+
+        // Make room for `size` more bytes and one more entry; the caller
+        // holds the mutex
+        void Evict(size_t size);
+
+        size_t capacity;
+        size_t byteBudget;
+        std::mutex mutex;
+        Common::LruCache<std::string, Entry> entries;
+        size_t cachedBytes = 0; // Sum of data.size() over the entries
+    };
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // PREFIX_HASH_CACHE_H
@@ -0,0 +1,215 @@
+/* clang-format off */
+/*
+ * @file tree_hash.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "tree_hash.h"
+#include "algorithm/common/executor.h"
+#include <algorithm>
+#include <functional>
+namespace CryptoToysPP::Algorithm::Hash {
+    namespace {
+        constexpr uint8_t LEAF_PREFIX = 0x00;
+        constexpr uint8_t NODE_PREFIX = 0x01;
+
+        size_t LeafCount(size_t bytes) {
+            return (bytes + TreeHash::LEAF_SIZE - 1) / TreeHash::LEAF_SIZE;
+        }
+
+        // Hash every leaf of `data` into `out` (one digest per leaf),
+        // spreading the leaves over the shared executor
+        void HashLeafRange(const Hasher &prototype,
+                           std::span<const uint8_t> data,
+                           uint8_t *out) {
+            const size_t count = LeafCount(data.size());
+            const size_t digestSize = prototype.DigestSize();
+            auto body = [&](size_t begin, size_t end) {
+                Hasher hasher(prototype);
+                for (size_t i = begin; i < end; ++i) {
+                    const size_t offset = i * TreeHash::LEAF_SIZE;
+                    hasher.Update(std::span(&LEAF_PREFIX, 1))
+                            .Update(data.subspan(
+                                    offset, std::min(TreeHash::LEAF_SIZE,
+                                                     data.size() - offset)));
+                    std::ranges::copy(hasher.Final(), out + i * digestSize);
+                }
+            };
+            if (count > 1 && Common::Executor::Shared().ThreadCount() > 1)
+                Common::Executor::Shared().ParallelFor(count, 1, body);
+            else
+                body(0, count);
+        }
+    } // namespace
+
+    size_t TreeHash::Result::LeafCount() const {
+        return digestSize == 0 ? 0 : leaves.size() / digestSize;
+    }
+
+    std::span<const uint8_t> TreeHash::Result::Leaf(size_t index) const {
+        return std::span(leaves).subspan(index * digestSize, digestSize);
+    }
+
+    TreeHash::TreeHash(Hasher::Type type) :
+        prototype(type), digestSize(prototype.DigestSize()),
+        batchLeaves(std::max<size_t>(
+                1, Common::Executor::Shared().ThreadCount() * 2)) {
+    }
+
+    void TreeHash::HashLeaves(std::span<const uint8_t> data) {
+        const size_t offset = leaves.size();
+        leaves.resize(offset + LeafCount(data.size()) * digestSize);
+        HashLeafRange(prototype, data, leaves.data() + offset);
+    }
+
+    TreeHash &TreeHash::Update(std::span<const uint8_t> data) {
+        bytes += data.size();
+        // Small updates are gathered until a parallel pass has a leaf for
+        // every worker; large ones are hashed in place
+        const size_t batchBytes = batchLeaves * LEAF_SIZE;
+        if (!pending.empty()) {
+            const size_t take =
+                    std::min(data.size(), batchBytes - pending.size());
+            pending.insert(pending.end(), data.begin(), data.begin() + take);
+            data = data.subspan(take);
+            if (pending.size() < batchBytes)
+                return *this;
+            HashLeaves(pending);
+            pending.clear();
+        }
+        if (data.size() >= batchBytes) {
+            const size_t whole = data.size() / LEAF_SIZE * LEAF_SIZE;
+            HashLeaves(data.first(whole));
+            data = data.subspan(whole);
+        }
+        pending.insert(pending.end(), data.begin(), data.end());
+        return *this;
+    }
+
+    TreeHash &TreeHash::Update(std::string_view data) {
+        return Update(std::span(reinterpret_cast<const uint8_t *>(data.data()),
+                                data.size()));
+    }
+
+    TreeHash &TreeHash::Update(std::istream &input) {
+        std::vector<char> buffer(batchLeaves * LEAF_SIZE);
+        while (input) {
+            input.read(buffer.data(), static_cast<std::streamsize>(
+                                              buffer.size()));
+            const auto got = static_cast<size_t>(input.gcount());
+            if (got == 0)
+                break;
+            Update(std::string_view(buffer.data(), got));
+        }
+        return *this;
+    }
+
+    TreeHash::Result TreeHash::Final() {
+        HashLeaves(pending);
+        Result result;
+        result.root = Root(prototype.GetType(), leaves);
+        result.leaves = std::move(leaves);
+        result.digestSize = digestSize;
+        result.bytes = bytes;
+
+        pending.clear();
+        pending.shrink_to_fit();
+        leaves.clear();
+        bytes = 0;
+        return result;
+    }
+
+    TreeHash::Result TreeHash::HashFile(Hasher::Type type,
+                                        const std::string &path,
+                                        Common::FileSource::Access access) {
+        TreeHash tree(type);
+        Common::FileSource source(path, access);
+        while (true) {
+            const std::span<const uint8_t> block = source.Next();
+            if (block.empty())
+                break;
+            tree.Update(block);
+        }
+        return tree.Final();
+    }
+
+    std::vector<uint8_t> TreeHash::Root(Hasher::Type type,
+                                        std::span<const uint8_t> leaves) {
+        Hasher hasher(type);
+        const size_t digestSize = hasher.DigestSize();
+        size_t count = leaves.size() / digestSize;
+        if (count == 0)
+            return hasher.Final();
+
+        std::vector<uint8_t> level(leaves.begin(),
+                                   leaves.begin() + count * digestSize);
+        while (count > 1) {
+            const size_t pairs = count / 2;
+            for (size_t i = 0; i < pairs; ++i) {
+                const std::vector<uint8_t> node =
+                        hasher.Update(std::span(&NODE_PREFIX, 1))
+                                .Update(std::span(level).subspan(
+                                        2 * i * digestSize, 2 * digestSize))
+                                .Final();
+                std::ranges::copy(node, level.begin() + i * digestSize);
+            }
+            // An unpaired last node moves up unchanged
+            if (count % 2 != 0)
+                std::copy_n(level.begin() + (count - 1) * digestSize,
+                            digestSize, level.begin() + pairs * digestSize);
+            count = pairs + count % 2;
+        }
+        level.resize(digestSize);
+        return level;
+    }
+
+    bool TreeHash::VerifyLeaves(Hasher::Type type,
+                                std::span<const uint8_t> root,
+                                std::span<const uint8_t> leaves) {
+        if (leaves.size() % Hasher(type).DigestSize() != 0)
+            return false;
+        return std::ranges::equal(Root(type, leaves), root);
+    }
+
+    bool TreeHash::VerifyRange(Hasher::Type type,
+                               std::span<const uint8_t> leaves,
+                               size_t firstLeaf,
+                               std::span<const uint8_t> data) {
+        const Hasher prototype(type);
+        const size_t digestSize = prototype.DigestSize();
+        const size_t total = leaves.size() / digestSize;
+        const size_t count = LeafCount(data.size());
+        if (leaves.size() % digestSize != 0 || firstLeaf > total ||
+            count > total - firstLeaf)
+            return false;
+        // Only the tree's last leaf may be short
+        if (data.size() % LEAF_SIZE != 0 && firstLeaf + count != total)
+            return false;
+
+        std::vector<uint8_t> actual(count * digestSize);
+        HashLeafRange(prototype, data, actual.data());
+        return std::ranges::equal(
+                actual, leaves.subspan(firstLeaf * digestSize, actual.size()));
+    }
+} // namespace CryptoToysPP::Algorithm::Hash
@@ -0,0 +1,126 @@
+/* clang-format off */
+/*
+ * @file tree_hash.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef TREE_HASH_H
+#define TREE_HASH_H
+#include "hasher.h"
+#include "algorithm/common/file_source.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+namespace CryptoToysPP::Algorithm::Hash {
+    // Merkle tree hash over fixed-size leaves, with the node encoding of
+    // RFC 6962 (Certificate Transparency):
+    //
+    //     leaf  = H(0x00 || data[i * LEAF_SIZE, (i + 1) * LEAF_SIZE))
+    //     node  = H(0x01 || left || right)
+    //     root  = H("") for empty input, else the top node
+    //
+    // Only the last leaf may be short. Nodes are paired left to right on
+    // each level and an unpaired last node moves up unchanged, which
+    // gives the same root as RFC 6962's largest-power-of-two split. Both
+    // LEAF_SIZE and the encoding are part of the output format and must
+    // not change.
+    //
+    // Leaves are hashed in parallel on the shared executor. Keeping the
+    // leaf hashes lets a sub-range be verified by rehashing only the
+    // leaves it covers: VerifyLeaves checks a stored leaf list against the
+    // root once (O(leaves)), after which each VerifyRange costs only the
+    // range itself.
+    class TreeHash {
+    public:
+        static constexpr size_t LEAF_SIZE = 1024 * 1024;
+
+        struct Result {
+            std::vector<uint8_t> root;
+            std::vector<uint8_t> leaves; // Leaf hashes packed back to back
+            size_t digestSize = 0;
+            uint64_t bytes = 0;
+
+            [[nodiscard]] size_t LeafCount() const;
+
+            [[nodiscard]] std::span<const uint8_t> Leaf(size_t index) const;
+        };
+
+        // Throws std::invalid_argument for Type::UNKNOWN
+        explicit TreeHash(Hasher::Type type = Hasher::Type::SHA256);
+
+        TreeHash &Update(std::span<const uint8_t> data);
+
+        TreeHash &Update(std::string_view data);
+
+        // Consume the stream to its end
+        TreeHash &Update(std::istream &input);
+
+        // Hash what is left and start over
+        Result Final();
+
+        // Tree of a whole file ("-" for stdin), read through
+        // Common::FileSource
+        static Result HashFile(Hasher::Type type,
+                               const std::string &path,
+                               Common::FileSource::Access access =
+                                       Common::FileSource::Access::MAP);
+
+        // Root over a packed list of leaf hashes
+        static std::vector<uint8_t> Root(Hasher::Type type,
+                                         std::span<const uint8_t> leaves);
+
+        // True when the packed leaf hashes produce `root`. Rebuilds the
+        // tree, so callers check a leaf list once and keep the result.
+        static bool VerifyLeaves(Hasher::Type type,
+                                 std::span<const uint8_t> root,
+                                 std::span<const uint8_t> leaves);
+
+        // True when `data`, which starts at leaf `firstLeaf`, matches the
+        // leaf hashes it covers. Only those leaves are hashed; `leaves`
+        // must already have passed VerifyLeaves. `data` may end inside a
+        // leaf only if that is the last one.
+        static bool VerifyRange(Hasher::Type type,
+                                std::span<const uint8_t> leaves,
+                                size_t firstLeaf,
+                                std::span<const uint8_t> data);
+
+    private:
+        // Append the hashes of the leaves in `data` (the last may be
+        // short)
+        void HashLeaves(std::span<const uint8_t> data);
+
+        Hasher prototype;
+        size_t digestSize;
+        size_t batchLeaves; // Leaves gathered before a parallel pass
+        std::vector<uint8_t> pending; // Input not yet hashed
+        std::vector<uint8_t> leaves;
+        uint64_t bytes = 0;
+    };
+} // namespace CryptoToysPP::Algorithm::Hash
+
+#endif // TREE_HASH_H
@@ -0,0 +1,328 @@
+/* clang-format off */
+/*
+ * @file section.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "section.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+namespace CryptoToysPP::Algorithm::Simple {
+    namespace {
+        constexpr size_t LINE_BYTES = 45;
+        // Length character, 60 data characters and the newline
+        constexpr size_t LINE_SIZE = 1 + LINE_BYTES / 3 * 4 + 1;
+        // Lines outside sections are buffered up to this size while
+        // looking for "begin"; longer ones are skipped
+        constexpr size_t MAX_LINE = 4096;
+        // Decoded bytes are handed over in pieces of about this size
+        constexpr size_t FLUSH_SIZE = size_t{64} << 10;
+        constexpr uint8_t INVALID = 0xFF;
+
+        // Character of each 6-bit value; index 0 doubles as the length of
+        // the terminating line. UU maps 0 to '`' rather than ' ' so that
+        // lines carry no trailing spaces.
+        constexpr char UU_CHARS[] = "`!\"#$%&'()*+,-./0123456789:;<=>?"
+                                    "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_";
+        constexpr char XX_CHARS[] = "+-0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                    "abcdefghijklmnopqrstuvwxyz";
+
+        using ValueTable = std::array<uint8_t, 256>;
+
+        constexpr ValueTable UU_VALUES = [] {
+            ValueTable table{};
+            table.fill(INVALID);
+            // Both ' ' and '`' stand for 0, as older encoders used spaces
+            for (size_t c = 32; c <= 96; ++c)
+                table[c] = static_cast<uint8_t>((c - 32) & 0x3F);
+            return table;
+        }();
+
+        constexpr ValueTable XX_VALUES = [] {
+            ValueTable table{};
+            table.fill(INVALID);
+            for (uint8_t i = 0; i < 64; ++i)
+                table[static_cast<uint8_t>(XX_CHARS[i])] = i;
+            return table;
+        }();
+
+        const char *CharsFor(const SectionFormat format) {
+            return format == SectionFormat::UU ? UU_CHARS : XX_CHARS;
+        }
+
+        const ValueTable &ValuesFor(const SectionFormat format) {
+            return format == SectionFormat::UU ? UU_VALUES : XX_VALUES;
+        }
+
+        uint8_t *EncodeLine(const uint8_t *data,
+                            const size_t size,
+                            uint8_t *cursor,
+                            const char *chars) {
+            *cursor++ = chars[size];
+            for (size_t i = 0; i < size; i += 3) {
+                const uint8_t b1 = data[i];
+                const uint8_t b2 = i + 1 < size ? data[i + 1] : 0;
+                const uint8_t b3 = i + 2 < size ? data[i + 2] : 0;
+                *cursor++ = chars[b1 >> 2];
+                *cursor++ = chars[((b1 & 0x03) << 4) | (b2 >> 4)];
+                *cursor++ = chars[((b2 & 0x0F) << 2) | (b3 >> 6)];
+                *cursor++ = chars[b3 & 0x3F];
+            }
+            *cursor++ = '\n';
+            return cursor;
+        }
+
+        std::string_view AsText(std::span<const uint8_t> line) {
+            return {reinterpret_cast<const char *>(line.data()), line.size()};
+        }
+
+        // "begin <octal mode> <name>"; the name runs to the end of the line
+        // and may contain spaces
+        bool ParseBegin(std::string_view line,
+                        std::string_view &name,
+                        uint32_t &mode) {
+            constexpr std::string_view PREFIX = "begin ";
+            if (!line.starts_with(PREFIX))
+                return false;
+            line.remove_prefix(PREFIX.size());
+            const char *end = line.data() + line.size();
+            const auto [next, error] =
+                    std::from_chars(line.data(), end, mode, 8);
+            const auto digits = static_cast<size_t>(next - line.data());
+            if (error != std::errc() || digits > 6 || next == end ||
+                *next != ' ' || next + 1 == end)
+                return false;
+            mode &= 07777;
+            name = std::string_view(next + 1, end);
+            return true;
+        }
+
+        // "end", tolerating trailing blanks added by mail software
+        bool IsEnd(std::string_view line) {
+            if (!line.starts_with("end"))
+                return false;
+            line.remove_prefix(3);
+            return std::ranges::all_of(
+                    line, [](const char c) { return c == ' ' || c == '\t'; });
+        }
+    } // namespace
+
+    SectionEncoder::SectionEncoder(const SectionFormat format)
+        : format(format) {
+    }
+
+    std::string SectionEncoder::Begin(std::string_view name, uint32_t mode) {
+        if (name.empty() || name.find_first_of("\r\n") != name.npos)
+            throw std::invalid_argument("Invalid section name");
+        char octal[8];
+        const auto result =
+                std::to_chars(octal, octal + sizeof(octal), mode & 07777, 8);
+        std::string line = "begin ";
+        line.append(octal, result.ptr);
+        line += ' ';
+        line += name;
+        line += '\n';
+        return line;
+    }
+
+    size_t SectionEncoder::MaxUpdateSize(size_t size) {
+        // The pending bytes complete at most one extra line
+        return (size + LINE_BYTES - 1) / LINE_BYTES * LINE_SIZE;
+    }
+
+    size_t SectionEncoder::Update(std::span<const uint8_t> in,
+                                  std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxUpdateSize(in.size()));
+        const char *chars = CharsFor(format);
+        uint8_t *cursor = out.data();
+        size_t i = 0;
+
+        if (count > 0) {
+            i = std::min(LINE_BYTES - count, in.size());
+            std::copy_n(in.data(), i, line + count);
+            count += i;
+            if (count < LINE_BYTES)
+                return 0;
+            cursor = EncodeLine(line, LINE_BYTES, cursor, chars);
+            count = 0;
+        }
+        for (; in.size() - i >= LINE_BYTES; i += LINE_BYTES)
+            cursor = EncodeLine(in.data() + i, LINE_BYTES, cursor, chars);
+
+        count = in.size() - i;
+        std::copy_n(in.data() + i, count, line);
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    size_t SectionEncoder::Finish(std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MAX_FINISH_SIZE);
+        const char *chars = CharsFor(format);
+        uint8_t *cursor = out.data();
+        if (count > 0)
+            cursor = EncodeLine(line, count, cursor, chars);
+        cursor = EncodeLine(nullptr, 0, cursor, chars);
+        cursor = std::copy_n("end\n", 4, cursor);
+        count = 0;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    SectionDecoder::SectionDecoder(const SectionFormat format,
+                                   Handler handler)
+        : format(format), handler(std::move(handler)) {
+    }
+
+    bool SectionDecoder::Update(std::string_view in) {
+        return Update(Common::AsBytes(in));
+    }
+
+    bool SectionDecoder::Update(std::span<const uint8_t> in) {
+        size_t pos = 0;
+        while (!failed && pos < in.size()) {
+            const auto *newline = static_cast<const uint8_t *>(
+                    std::memchr(in.data() + pos, '\n', in.size() - pos));
+            const size_t end = newline != nullptr
+                    ? static_cast<size_t>(newline - in.data())
+                    : in.size();
+            const std::span<const uint8_t> piece = in.subspan(pos, end - pos);
+
+            if (!overlong && partial.size() + piece.size() > MAX_LINE) {
+                // No valid body line comes close to this length
+                overlong = true;
+                partial.clear();
+                failed = inSection;
+            }
+            if (newline == nullptr) {
+                if (!overlong)
+                    partial.append(AsText(piece));
+                break;
+            }
+
+            if (overlong) {
+                overlong = false;
+            } else if (partial.empty()) {
+                failed = !ProcessLine(piece);
+            } else {
+                partial.append(AsText(piece));
+                failed = !ProcessLine(Common::AsBytes(partial));
+                partial.clear();
+            }
+            pos = end + 1;
+        }
+        if (!failed)
+            Flush();
+        return !failed;
+    }
+
+    bool SectionDecoder::Finish() {
+        if (!failed && !overlong && !partial.empty())
+            failed = !ProcessLine(Common::AsBytes(partial));
+        if (!failed)
+            Flush();
+        const bool complete = !failed && !inSection;
+
+        partial.clear();
+        decoded.clear();
+        overlong = false;
+        inSection = false;
+        terminated = false;
+        failed = false;
+        return complete;
+    }
+
+    bool SectionDecoder::ProcessLine(std::span<const uint8_t> line) {
+        if (!line.empty() && line.back() == '\r')
+            line = line.first(line.size() - 1);
+        const std::string_view text = AsText(line);
+
+        if (!inSection) {
+            std::string_view name;
+            uint32_t mode = 0;
+            if (ParseBegin(text, name, mode)) {
+                inSection = true;
+                terminated = false;
+                if (handler.begin)
+                    handler.begin(name, mode);
+            }
+            return true;
+        }
+        // "end" cannot be mistaken for a body line: 'e' announces more
+        // bytes than three characters can hold in both alphabets
+        if (IsEnd(text)) {
+            Flush();
+            inSection = false;
+            if (handler.end)
+                handler.end();
+            return true;
+        }
+        if (terminated || line.empty())
+            return true;
+        return DecodeLine(line);
+    }
+
+    bool SectionDecoder::DecodeLine(std::span<const uint8_t> line) {
+        const ValueTable &values = ValuesFor(format);
+        const uint8_t size = values[line[0]];
+        if (size == 0) {
+            terminated = true;
+            return true;
+        }
+        if (size > LINE_BYTES)
+            return false;
+        // Characters past the last group, such as old checksums, are
+        // ignored
+        const size_t chars = (size + 2) / 3 * 4;
+        if (line.size() < 1 + chars)
+            return false;
+
+        uint8_t bytes[LINE_BYTES + 2];
+        uint8_t *cursor = bytes;
+        for (size_t i = 1; i <= chars; i += 4) {
+            const uint8_t v1 = values[line[i]];
+            const uint8_t v2 = values[line[i + 1]];
+            const uint8_t v3 = values[line[i + 2]];
+            const uint8_t v4 = values[line[i + 3]];
+            if ((v1 | v2 | v3 | v4) > 63)
+                return false;
+            *cursor++ = static_cast<uint8_t>((v1 << 2) | (v2 >> 4));
+            *cursor++ = static_cast<uint8_t>((v2 << 4) | (v3 >> 2));
+            *cursor++ = static_cast<uint8_t>((v3 << 6) | v4);
+        }
+        decoded.insert(decoded.end(), bytes, bytes + size);
+        if (decoded.size() >= FLUSH_SIZE)
+            Flush();
+        return true;
+    }
+
+    void SectionDecoder::Flush() {
+        if (decoded.empty())
+            return;
+        if (handler.data)
+            handler.data(decoded);
+        decoded.clear();
+    }
+} // namespace CryptoToysPP::Algorithm::Simple
@@ -0,0 +1,123 @@
+/* clang-format off */
+/*
+ * @file section.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef SECTION_H
+#define SECTION_H
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "algorithm/common/stream_codec.h"
+namespace CryptoToysPP::Algorithm::Simple {
+    // Line encoding of a section; both use lines of up to 45 bytes
+    enum class SectionFormat { UU, XX };
+
+    // Complete uuencode(1)/xxencode(1) files:
+    //
+    //     begin 644 name
+    //     <body lines>
+    //     `            (a zero-length line, "+" for xxencode)
+    //     end
+    //
+    // Several sections may follow each other, embedded in arbitrary text
+    // such as a mail archive.
+    class SectionEncoder : public Common::StreamEncoderBase<SectionEncoder> {
+    public:
+        using StreamEncoderBase::Finish;
+        using StreamEncoderBase::Update;
+
+        // The last partial line, the zero-length line and "end\n"
+        static constexpr size_t MAX_FINISH_SIZE = 62 + 2 + 4;
+
+        explicit SectionEncoder(SectionFormat format);
+
+        // The "begin <mode> <name>" line opening a section; write it
+        // before the section's first Update
+        static std::string Begin(std::string_view name, uint32_t mode = 0644);
+
+        static size_t MaxUpdateSize(size_t size);
+
+        // Encode the complete lines available so far; needs
+        // MaxUpdateSize(in.size()) bytes of room
+        size_t Update(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+        // Close the section and reset for the next one
+        size_t Finish(std::span<uint8_t> out);
+
+    private:
+        SectionFormat format;
+        uint8_t line[45] = {}; // pending input bytes
+        size_t count = 0;      // number of pending bytes, below 45
+    };
+
+    // Single-pass reader for text holding any number of sections. Lines
+    // outside sections are ignored; the decoded bytes of each section are
+    // handed to the handler as they are parsed, so nothing but the
+    // current line is kept in memory.
+    class SectionDecoder {
+    public:
+        struct Handler {
+            // A "begin" line; the name is as written, callers must
+            // sanitize it before using it as a path
+            std::function<void(std::string_view name, uint32_t mode)> begin;
+            std::function<void(std::span<const uint8_t> data)> data;
+            std::function<void()> end;
+        };
+
+        SectionDecoder(SectionFormat format, Handler handler);
+
+        // Feed the next piece of text; returns false once a section body
+        // is malformed, and for every later call
+        bool Update(std::span<const uint8_t> in);
+
+        bool Update(std::string_view in);
+
+        // Process a last line lacking its newline; returns false for
+        // malformed input or a section missing its "end" line
+        bool Finish();
+
+    private:
+        bool ProcessLine(std::span<const uint8_t> line);
+
+        bool DecodeLine(std::span<const uint8_t> line);
+
+        void Flush();
+
+        SectionFormat format;
+        Handler handler;
+        std::string partial;    // start of a line split across Updates
+        bool overlong = false;  // skipping the rest of an overlong line
+        bool inSection = false;
+        bool terminated = false; // zero-length line seen, "end" expected
+        bool failed = false;
+        std::vector<uint8_t> decoded; // bytes not yet given to the handler
+    };
+} // namespace CryptoToysPP::Algorithm::Simple
+
+#endif // SECTION_H
@@ -26,27 +26,58 @@
  */
 /* clang-format on */
 #include "uucode.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
 namespace CryptoToysPP::Algorithm::Simple {
-    std::vector<uint8_t> UUCode::Encode(const std::vector<uint8_t> &data) {
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> output;
-        const size_t buff_len = data.size();
+    namespace {
+        // Lines carry at most 45 bytes: a length character, 60 data
+        // characters and a newline
+        constexpr size_t LINE_BYTES = 45;
+
+        uint8_t EncodeChar(const uint8_t c) {
+            return (c == 0) ? 96 : c + 32;
+        }
+
+        // Both ' ' and EncodeChar's '`' stand for 0
+        bool IsValidChar(const uint8_t c) {
+            return c >= 32 && c <= 96;
+        }
+    } // namespace
+
+    size_t UUCode::MaxEncodedSize(size_t size) {
+        if (size == 0)
+            return 0;
+        const size_t remainder = size % LINE_BYTES;
+        // Full lines, the partial line and the "`\n" terminator
+        return size / LINE_BYTES * (LINE_BYTES / 3 * 4 + 2) +
+                (remainder == 0 ? 0 : (remainder + 2) / 3 * 4 + 2) + 2;
+    }
+
+    size_t UUCode::MaxDecodedSize(size_t size) {
+        return size / 4 * 3 + size % 4 * 3 / 4;
+    }
+
+    size_t UUCode::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        if (in.empty())
+            return 0;
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        uint8_t *cursor = out.data();
+        const size_t buff_len = in.size();
         size_t bytes_processed = 0;
 
         while (bytes_processed < buff_len) {
-            size_t bytes_left = buff_len - bytes_processed;
             const size_t n_actual =
-                    std::min(bytes_left, static_cast<size_t>(45));
+                    std::min(buff_len - bytes_processed, LINE_BYTES);
             const size_t padded_len = ((n_actual + 2) / 3) * 3;
 
-            output.push_back(static_cast<uint8_t>(n_actual + 32));
+            *cursor++ = static_cast<uint8_t>(n_actual + 32);
 
-            for (int32_t i = 0; i < padded_len; i += 3) {
+            for (size_t i = 0; i < padded_len; i += 3) {
                 uint8_t trio[3] = {};
-                for (int32_t j = 0; j < 3; ++j) {
+                for (size_t j = 0; j < 3; ++j) {
                     const size_t pos = bytes_processed + i + j;
-                    trio[j] = (pos < buff_len) ? data[pos] : 0;
+                    trio[j] = (pos < buff_len) ? in[pos] : 0;
                 }
 
                 const uint8_t c1 = (trio[0] >> 2) & 0x3F;
@@ -56,34 +87,30 @@ namespace CryptoToysPP::Algorithm::Simple {
                         ((trio[1] << 2) & 0x3C) | ((trio[2] >> 6) & 0x03);
                 const uint8_t c4 = trio[2] & 0x3F;
 
-                auto encode_char = [](const uint8_t c) {
-                    return (c == 0) ? 96 : c + 32;
-                };
-                output.push_back(encode_char(c1));
-                output.push_back(encode_char(c2));
-                output.push_back(encode_char(c3));
-                output.push_back(encode_char(c4));
+                *cursor++ = EncodeChar(c1);
+                *cursor++ = EncodeChar(c2);
+                *cursor++ = EncodeChar(c3);
+                *cursor++ = EncodeChar(c4);
             }
 
-            output.push_back('\n');
+            *cursor++ = '\n';
             bytes_processed += n_actual;
         }
 
-        output.push_back(96);
-        output.push_back('\n');
-        return output;
+        *cursor++ = 96;
+        *cursor++ = '\n';
+        return static_cast<size_t>(cursor - out.data());
     }
 
-    std::vector<uint8_t> UUCode::Decode(const std::vector<uint8_t> &data) {
-        if (data.empty())
-            return {};
-        std::vector<uint8_t> output;
+    std::optional<size_t> UUCode::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        uint8_t *cursor = out.data();
         size_t in_index = 0;
-        size_t total_len = 0;
 
-        while (in_index < data.size()) {
+        while (in_index < in.size()) {
             size_t line_end = in_index;
-            while (line_end < data.size() && data[line_end] != '\n') {
+            while (line_end < in.size() && in[line_end] != '\n') {
                 ++line_end;
             }
 
@@ -92,66 +119,72 @@ namespace CryptoToysPP::Algorithm::Simple {
                 continue;
             }
 
-            const uint8_t n_char = data[in_index];
-            const int32_t n_actual = (n_char - 32) & 0x3F;
+            const uint8_t n_char = in[in_index];
+            const size_t n_actual = (n_char - 32) & 0x3F;
 
             if (n_actual == 0)
                 break;
-            if (n_actual > 45)
-                return {};
+            if (n_actual > LINE_BYTES)
+                return std::nullopt;
 
-            const int32_t expected_chars = ((n_actual + 2) / 3) * 4;
+            const size_t expected_chars = ((n_actual + 2) / 3) * 4;
             const size_t data_start = in_index + 1;
-            if (const size_t data_end = data_start + expected_chars;
-                data_end > line_end)
-                return {};
-
-            const size_t output_before = output.size();
-            for (int32_t i = 0; i < expected_chars; i += 4) {
-                if (data_start + i + 3 >= data.size())
-                    return {};
-
-                const uint8_t c1 = data[data_start + i];
-                const uint8_t c2 = data[data_start + i + 1];
-                const uint8_t c3 = data[data_start + i + 2];
-                const uint8_t c4 = data[data_start + i + 3];
-
-                auto is_valid = [](const uint8_t c) {
-                    return c >= 32 && c <= 95;
-                };
-                if (!is_valid(c1) || !is_valid(c2) || !is_valid(c3) ||
-                    !is_valid(c4))
-                    return {};
+            if (data_start + expected_chars > line_end)
+                return std::nullopt;
+
+            size_t remaining = n_actual;
+            for (size_t i = 0; i < expected_chars; i += 4) {
+                const uint8_t c1 = in[data_start + i];
+                const uint8_t c2 = in[data_start + i + 1];
+                const uint8_t c3 = in[data_start + i + 2];
+                const uint8_t c4 = in[data_start + i + 3];
+
+                if (!IsValidChar(c1) || !IsValidChar(c2) ||
+                    !IsValidChar(c3) || !IsValidChar(c4))
+                    return std::nullopt;
 
                 const uint8_t v1 = (c1 - 32) & 0x3F;
                 const uint8_t v2 = (c2 - 32) & 0x3F;
                 const uint8_t v3 = (c3 - 32) & 0x3F;
                 const uint8_t v4 = (c4 - 32) & 0x3F;
 
-                output.push_back((v1 << 2) | (v2 >> 4));
-                output.push_back(((v2 & 0x0F) << 4) | (v3 >> 2));
-                output.push_back(((v3 & 0x03) << 6) | v4);
+                const uint8_t trio[3] = {
+                        static_cast<uint8_t>((v1 << 2) | (v2 >> 4)),
+                        static_cast<uint8_t>(((v2 & 0x0F) << 4) | (v3 >> 2)),
+                        static_cast<uint8_t>(((v3 & 0x03) << 6) | v4)};
+                const size_t take = std::min<size_t>(3, remaining);
+                cursor = std::copy_n(trio, take, cursor);
+                remaining -= take;
             }
 
-            output.resize(output_before + n_actual);
-            total_len += n_actual;
             in_index = line_end + 1;
         }
+        return static_cast<size_t>(cursor - out.data());
+    }
 
-        return output;
+    std::vector<uint8_t> UUCode::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> UUCode::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string UUCode::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string UUCode::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Simple
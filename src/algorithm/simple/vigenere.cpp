@@ -26,79 +26,96 @@
  */
 /* clang-format on */
 #include "vigenere.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
 namespace CryptoToysPP::Algorithm::Simple {
-    std::vector<uint8_t> Vigenere::Encode(const std::vector<uint8_t> &data,
-                                          const std::vector<uint8_t> &key) {
-        if (data.empty() || key.empty())
-            return {};
-        std::vector<uint8_t> result;
-        for (const auto k : key) {
-            if (!((k >= 'a' && k <= 'z') || (k >= 'A' && k <= 'Z')))
-                return {};
+    namespace {
+        bool IsLetter(const uint8_t c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
         }
 
-        size_t key_index = 0;
-        for (auto c : data) {
-            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+        // Shift letters by the key (negated for decoding); the key only
+        // advances on letters
+        std::optional<size_t> Shift(std::span<const uint8_t> data,
+                                    std::span<const uint8_t> key,
+                                    std::span<uint8_t> out,
+                                    bool decode) {
+            if (key.empty() || !std::ranges::all_of(key, IsLetter))
+                return std::nullopt;
+            Common::RequireCapacity(out, data.size());
+
+            size_t key_index = 0;
+            for (size_t i = 0; i < data.size(); ++i) {
+                const uint8_t c = data[i];
+                if (!IsLetter(c)) {
+                    out[i] = c;
+                    continue;
+                }
                 const uint8_t base = (c >= 'a') ? 'a' : 'A';
-                const int32_t offset = (key[key_index % key.size()] >= 'A' &&
-                                        key[key_index % key.size()] <= 'Z')
-                        ? (key[key_index % key.size()] - 'A')
-                        : (key[key_index % key.size()] - 'a');
-                const int32_t shifted = (c - base + offset) % 26;
-                result.push_back(static_cast<uint8_t>(base + shifted));
+                const uint8_t k = key[key_index % key.size()];
+                const int32_t offset = (k >= 'A' && k <= 'Z') ? (k - 'A')
+                                                               : (k - 'a');
+                const int32_t shifted = decode
+                        ? (c - base - offset + 26) % 26
+                        : (c - base + offset) % 26;
+                out[i] = static_cast<uint8_t>(base + shifted);
                 key_index++;
-            } else {
-                result.push_back(c);
             }
+            return data.size();
         }
-        return result;
+    } // namespace
+
+    size_t Vigenere::MaxEncodedSize(size_t size) {
+        return size;
     }
 
-    std::vector<uint8_t> Vigenere::Decode(const std::vector<uint8_t> &data,
-                                          const std::vector<uint8_t> &key) {
-        if (data.empty() || key.empty())
-            return {};
-        std::vector<uint8_t> result;
+    size_t Vigenere::MaxDecodedSize(size_t size) {
+        return size;
+    }
 
-        for (const auto k : key) {
-            if (!((k >= 'a' && k <= 'z') || (k >= 'A' && k <= 'Z')))
-                return {};
-        }
+    std::optional<size_t> Vigenere::Encode(std::span<const uint8_t> data,
+                                           std::span<const uint8_t> key,
+                                           std::span<uint8_t> out) {
+        return Shift(data, key, out, false);
+    }
 
-        size_t key_index = 0;
-        for (auto c : data) {
-            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
-                const uint8_t base = (c >= 'a') ? 'a' : 'A';
-                const int32_t offset = (key[key_index % key.size()] >= 'A' &&
-                                        key[key_index % key.size()] <= 'Z')
-                        ? (key[key_index % key.size()] - 'A')
-                        : (key[key_index % key.size()] - 'a');
-                const int32_t shifted = (c - base - offset + 26) % 26;
-                result.push_back(static_cast<uint8_t>(base + shifted));
-                key_index++;
-            } else {
-                result.push_back(c);
-            }
-        }
-        return result;
+    std::optional<size_t> Vigenere::Decode(std::span<const uint8_t> data,
+                                           std::span<const uint8_t> key,
+                                           std::span<uint8_t> out) {
+        return Shift(data, key, out, true);
+    }
+
+    std::vector<uint8_t> Vigenere::Encode(const std::vector<uint8_t> &data,
+                                          const std::vector<uint8_t> &key) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                data.size(), [&](std::span<uint8_t> out) {
+                    return Encode(data, key, out);
+                });
+    }
+
+    std::vector<uint8_t> Vigenere::Decode(const std::vector<uint8_t> &data,
+                                          const std::vector<uint8_t> &key) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                data.size(), [&](std::span<uint8_t> out) {
+                    return Decode(data, key, out);
+                });
     }
 
     std::string Vigenere::Encode(const std::string &data,
                                  const std::string &key) {
-        const std::vector<uint8_t> encode_data(data.begin(), data.end());
-        const std::vector<uint8_t> encode_key(key.begin(), key.end());
-        std::vector<uint8_t> encoded = Encode(encode_data, encode_key);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                data.size(), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), Common::AsBytes(key),
+                                  out);
+                });
     }
 
     std::string Vigenere::Decode(const std::string &data,
                                  const std::string &key) {
-        const std::vector<uint8_t> decode_data(data.begin(), data.end());
-        const std::vector<uint8_t> decode_key(key.begin(), key.end());
-        std::vector<uint8_t> decoded = Decode(decode_data, decode_key);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                data.size(), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), Common::AsBytes(key),
+                                  out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Simple
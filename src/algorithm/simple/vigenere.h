@@ -30,6 +30,8 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <optional>
+#include <span>
 namespace CryptoToysPP::Algorithm::Simple {
     class Vigenere {
     public:
@@ -44,6 +46,23 @@ namespace CryptoToysPP::Algorithm::Simple {
 
         static std::string Decode(const std::string &data,
                                   const std::string &key);
+
+        // Letters are shifted in place and everything else is copied, so
+        // the output is as long as the input
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Write into `out` (at least data.size() bytes, std::length_error
+        // otherwise; it may alias `data`). Returns the bytes written, or
+        // std::nullopt when the key is empty or not purely alphabetic.
+        static std::optional<size_t> Encode(std::span<const uint8_t> data,
+                                            std::span<const uint8_t> key,
+                                            std::span<uint8_t> out);
+
+        static std::optional<size_t> Decode(std::span<const uint8_t> data,
+                                            std::span<const uint8_t> key,
+                                            std::span<uint8_t> out);
     };
 } // namespace CryptoToysPP::Algorithm::Simple
 #endif // VIGENERE_H
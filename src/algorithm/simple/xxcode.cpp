@@ -26,124 +26,157 @@
  */
 /* clang-format on */
 #include "xxcode.h"
+#include "algorithm/common/byte_buffer.h"
+#include <algorithm>
+#include <array>
 namespace CryptoToysPP::Algorithm::Simple {
-    std::vector<uint8_t> XXCode::Encode(const std::vector<uint8_t> &data) {
-        if (data.empty())
-            return {};
-        const std::string base = "+-"
-                                 "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                 "jklmnopqrstuvwxyz";
-        std::vector<uint8_t> encoded;
-        const size_t total_size = data.size();
+    namespace {
+        constexpr uint8_t XX_CHARS[] = "+-"
+                                       "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                       "abcdefghijklmnopqrstuvwxyz";
+        constexpr int8_t INVALID = -1;
+
+        constexpr auto XX_TABLE = [] {
+            std::array<int8_t, 256> table{};
+            table.fill(INVALID);
+            for (int8_t i = 0; i < 64; ++i) {
+                table[XX_CHARS[i]] = i;
+            }
+            return table;
+        }();
+
+        // Lines carry at most 45 bytes and are separated by "\r\n"
+        constexpr size_t LINE_BYTES = 45;
+    } // namespace
+
+    size_t XXCode::MaxEncodedSize(size_t size) {
+        if (size == 0)
+            return 0;
+        const size_t lines = (size + LINE_BYTES - 1) / LINE_BYTES;
+        const size_t remainder = size % LINE_BYTES;
+        return size / LINE_BYTES * (LINE_BYTES / 3 * 4 + 1) +
+                (remainder == 0 ? 0 : (remainder + 2) / 3 * 4 + 1) +
+                (lines - 1) * 2;
+    }
+
+    size_t XXCode::MaxDecodedSize(size_t size) {
+        return size / 4 * 3 + size % 4 * 3 / 4;
+    }
+
+    size_t XXCode::Encode(std::span<const uint8_t> in,
+                          std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxEncodedSize(in.size()));
+        uint8_t *cursor = out.data();
+        const size_t total_size = in.size();
         size_t index = 0;
 
         while (index < total_size) {
             const size_t chunk_size =
-                    std::min(total_size - index, static_cast<size_t>(45));
-            encoded.push_back(base[chunk_size]);
+                    std::min(total_size - index, LINE_BYTES);
+            *cursor++ = XX_CHARS[chunk_size];
 
             const size_t groups = (chunk_size + 2) / 3;
             for (size_t g = 0; g < groups; ++g) {
                 const size_t pos = index + g * 3;
-                const uint8_t b1 = (pos < index + chunk_size) ? data[pos] : 0;
+                const uint8_t b1 = (pos < index + chunk_size) ? in[pos] : 0;
                 const uint8_t b2 =
-                        (pos + 1 < index + chunk_size) ? data[pos + 1] : 0;
+                        (pos + 1 < index + chunk_size) ? in[pos + 1] : 0;
                 const uint8_t b3 =
-                        (pos + 2 < index + chunk_size) ? data[pos + 2] : 0;
+                        (pos + 2 < index + chunk_size) ? in[pos + 2] : 0;
 
                 const uint8_t c1 = (b1 >> 2) & 0x3F;
                 const uint8_t c2 = ((b1 & 0x03) << 4) | ((b2 >> 4) & 0x0F);
                 const uint8_t c3 = ((b2 & 0x0F) << 2) | ((b3 >> 6) & 0x03);
                 const uint8_t c4 = b3 & 0x3F;
 
-                encoded.push_back(base[c1]);
-                encoded.push_back(base[c2]);
-                encoded.push_back(base[c3]);
-                encoded.push_back(base[c4]);
+                *cursor++ = XX_CHARS[c1];
+                *cursor++ = XX_CHARS[c2];
+                *cursor++ = XX_CHARS[c3];
+                *cursor++ = XX_CHARS[c4];
             }
 
             if (index + chunk_size < total_size) {
-                encoded.push_back('\r');
-                encoded.push_back('\n');
+                *cursor++ = '\r';
+                *cursor++ = '\n';
             }
             index += chunk_size;
         }
-        return encoded;
+        return static_cast<size_t>(cursor - out.data());
     }
 
-    std::vector<uint8_t> XXCode::Decode(const std::vector<uint8_t> &data) {
-        if (data.empty())
-            return {};
-        const std::string base = "+-"
-                                 "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghi"
-                                 "jklmnopqrstuvwxyz";
-        std::vector<uint8_t> decoded;
-        std::vector<std::vector<uint8_t>> lines;
-        int64_t i = 0;
-
-        while (i < data.size()) {
-            const int64_t start = i;
-            while (i < data.size() && data[i] != '\r' && data[i] != '\n')
+    // Lines with an unknown length character and groups with characters
+    // outside the alphabet are skipped, so decoding never fails
+    std::optional<size_t> XXCode::Decode(std::span<const uint8_t> in,
+                                         std::span<uint8_t> out) {
+        Common::RequireCapacity(out, MaxDecodedSize(in.size()));
+        uint8_t *cursor = out.data();
+        size_t i = 0;
+
+        while (i < in.size()) {
+            const size_t start = i;
+            while (i < in.size() && in[i] != '\r' && in[i] != '\n')
                 ++i;
-            lines.emplace_back(data.begin() + start, data.begin() + i);
-            if (i < data.size() && data[i] == '\r')
+            const std::span<const uint8_t> line = in.subspan(start, i - start);
+            if (i < in.size() && in[i] == '\r')
                 i += 2;
-            else if (i < data.size())
+            else if (i < in.size())
                 ++i;
-        }
 
-        for (const auto &line : lines) {
             if (line.empty())
                 continue;
 
-            const size_t chunk_size = base.find(static_cast<char>(line[0]));
-            if (chunk_size == std::string::npos)
+            const int32_t chunk_size = XX_TABLE[line[0]];
+            if (chunk_size == INVALID)
                 continue;
 
-            const size_t prev_size = decoded.size();
+            size_t remaining = static_cast<size_t>(chunk_size);
             const size_t groups = (line.size() - 1) / 4;
-
-            for (size_t g = 0; g < groups; ++g) {
+            for (size_t g = 0; g < groups && remaining > 0; ++g) {
                 const size_t pos = 1 + g * 4;
-                if (pos + 3 >= line.size())
-                    break;
+                const int32_t c1 = XX_TABLE[line[pos]];
+                const int32_t c2 = XX_TABLE[line[pos + 1]];
+                const int32_t c3 = XX_TABLE[line[pos + 2]];
+                const int32_t c4 = XX_TABLE[line[pos + 3]];
 
-                const uint8_t c1 = base.find(static_cast<char>(line[pos]));
-                const uint8_t c2 = base.find(static_cast<char>(line[pos + 1]));
-                const uint8_t c3 = base.find(static_cast<char>(line[pos + 2]));
-                const uint8_t c4 = base.find(static_cast<char>(line[pos + 3]));
-
-                if (c1 == std::string::npos || c2 == std::string::npos ||
-                    c3 == std::string::npos || c4 == std::string::npos)
+                if (c1 == INVALID || c2 == INVALID || c3 == INVALID ||
+                    c4 == INVALID)
                     continue;
 
-                uint8_t b1 = (c1 << 2) | (c2 >> 4);
-                uint8_t b2 = ((c2 & 0x0F) << 4) | (c3 >> 2);
-                uint8_t b3 = ((c3 & 0x03) << 6) | c4;
-
-                decoded.push_back(b1);
-                decoded.push_back(b2);
-                decoded.push_back(b3);
-            }
-
-            if (decoded.size() > prev_size + chunk_size) {
-                decoded.resize(prev_size + chunk_size);
+                const uint8_t trio[3] = {
+                        static_cast<uint8_t>((c1 << 2) | (c2 >> 4)),
+                        static_cast<uint8_t>(((c2 & 0x0F) << 4) | (c3 >> 2)),
+                        static_cast<uint8_t>(((c3 & 0x03) << 6) | c4)};
+                const size_t take = std::min<size_t>(3, remaining);
+                cursor = std::copy_n(trio, take, cursor);
+                remaining -= take;
             }
         }
-        return decoded;
+        return static_cast<size_t>(cursor - out.data());
+    }
+
+    std::vector<uint8_t> XXCode::Encode(const std::vector<uint8_t> &data) {
+        return Common::FillBuffer<std::vector<uint8_t>>(
+                MaxEncodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Encode(data, out); });
+    }
+
+    std::vector<uint8_t> XXCode::Decode(const std::vector<uint8_t> &data) {
+        return Common::TryFillBuffer<std::vector<uint8_t>>(
+                MaxDecodedSize(data.size()),
+                [&](std::span<uint8_t> out) { return Decode(data, out); });
     }
 
     std::string XXCode::Encode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> encoded = Encode(input);
-        std::string result(encoded.begin(), encoded.end());
-        return result;
+        return Common::FillBuffer<std::string>(
+                MaxEncodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Encode(Common::AsBytes(data), out);
+                });
     }
 
     std::string XXCode::Decode(const std::string &data) {
-        const std::vector<uint8_t> input(data.begin(), data.end());
-        std::vector<uint8_t> decoded = Decode(input);
-        std::string result(decoded.begin(), decoded.end());
-        return result;
+        return Common::TryFillBuffer<std::string>(
+                MaxDecodedSize(data.size()), [&](std::span<uint8_t> out) {
+                    return Decode(Common::AsBytes(data), out);
+                });
     }
 } // namespace CryptoToysPP::Algorithm::Simple
@@ -30,6 +30,8 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <optional>
+#include <span>
 namespace CryptoToysPP::Algorithm::Simple {
     class XXCode {
     public:
@@ -40,6 +42,21 @@ namespace CryptoToysPP::Algorithm::Simple {
         static std::string Encode(const std::string &data);
 
         static std::string Decode(const std::string &data);
+
+        // Output sizes for the caller-provided buffers below
+        static size_t MaxEncodedSize(size_t size);
+
+        static size_t MaxDecodedSize(size_t size);
+
+        // Encode into `out`, which must hold MaxEncodedSize(in.size())
+        // bytes (std::length_error otherwise); returns the bytes written
+        static size_t Encode(std::span<const uint8_t> in,
+                             std::span<uint8_t> out);
+
+        // Decode into `out` (MaxDecodedSize(in.size()) bytes); returns the
+        // bytes written, or std::nullopt for malformed input
+        static std::optional<size_t> Decode(std::span<const uint8_t> in,
+                                            std::span<uint8_t> out);
     };
 } // namespace CryptoToysPP::Algorithm::Simple
 #endif // XXENCODE_H
@@ -27,6 +27,7 @@
 /* clang-format on */
 #include "app.h"
 #include "frame.h"
+#include "algorithm/advance/rsa_key_pool.h"
 #include <fstream>
 #include <map>
 #include <wx/stdpaths.h>
@@ -194,6 +195,12 @@ namespace CryptoToysPP::Gui {
             return false;
         }
 
+        // Pre-generate RSA key pairs on idle cores so key generation
+        // requests return immediately. The generators start with the first
+        // request, so sessions that never use RSA do not wait for them on
+        // exit.
+        Algorithm::Advance::RSAKeyPool::Instance().StartLazily({});
+
         // Create main application window
         auto frame = new MainFrame();
         frame->Show();
@@ -203,6 +210,7 @@ namespace CryptoToysPP::Gui {
 
     int App::OnExit() {
         spdlog::info("Application exiting...");
+        Algorithm::Advance::RSAKeyPool::Instance().Stop();
         spdlog::shutdown(); // Automatically flush all logs
         return wxApp::OnExit();
     }
@@ -30,14 +30,51 @@
 #include "algorithm/base/base64.h"
 #include <spdlog/spdlog.h>
 namespace CryptoToysPP::Gui {
+    namespace {
+        // Page helper for the binary bridge (frame layout in transport.h):
+        // CryptoToysPPBridge.invoke(method, path, data, payload[, field])
+        // resolves to {meta, payload} with payload as a Uint8Array
+        constexpr const char *BRIDGE_SCRIPT = R"JS(
+window.CryptoToysPPBridge = {
+  seq: 0,
+  invoke: async function (method, path, data, payload, payloadField) {
+    const enc = new TextEncoder();
+    const body = typeof payload === 'string' ? enc.encode(payload)
+                                             : (payload || new Uint8Array(0));
+    const meta = enc.encode(JSON.stringify({
+      __id: 'bridge-' + (++this.seq), method: method, path: path,
+      data: data || {}, payloadField: payloadField || 'inputText'}));
+    const frame = new Uint8Array(4 + meta.length + body.length);
+    new DataView(frame.buffer).setUint32(0, meta.length, true);
+    frame.set(meta, 4);
+    frame.set(body, 4 + meta.length);
+    const res = await fetch('app://bridge', {method: 'POST', body: frame});
+    const bytes = new Uint8Array(await res.arrayBuffer());
+    const length = new DataView(bytes.buffer).getUint32(0, true);
+    return {
+      meta: JSON.parse(new TextDecoder().decode(bytes.subarray(4, 4 + length))),
+      payload: bytes.subarray(4 + length)
+    };
+  }
+};
+)JS";
+    } // namespace
+
     MainFrame::MainFrame() :
         wxFrame(nullptr,
                 wxID_ANY,
-                "CryptoToysPP - Encoding, Encryption and Decryption Toolbox") {
+                "CryptoToysPP - Encoding, Encryption and Decryption Toolbox"),
+        dispatcher(std::make_unique<Route::Dispatcher>(route)) {
         InitWebView();
         spdlog::debug("MainFrame initialized");
     }
 
+    MainFrame::~MainFrame() {
+        // Join the workers before the frame they report back to goes away
+        dispatcher->Shutdown();
+        spdlog::debug("MainFrame destroyed");
+    }
+
     void MainFrame::InitWebView() {
         spdlog::debug("Initializing WebView...");
         wxString backend = wxWebViewBackendDefault;
@@ -77,7 +114,8 @@ namespace CryptoToysPP::Gui {
 
         // Register scheme handler BEFORE Create()
         webview->RegisterHandler(
-                wxSharedPtr<wxWebViewHandler>(new Route::SchemeHandler()));
+                wxSharedPtr<wxWebViewHandler>(
+                        new Route::SchemeHandler(dispatcher.get())));
         spdlog::debug("Registered custom scheme handler");
 
         // Initialize the control
@@ -100,8 +138,8 @@ namespace CryptoToysPP::Gui {
 
         // Register scheme handler AFTER creation
         if (webview) {
-            webview->RegisterHandler(
-                    wxSharedPtr<wxWebViewHandler>(new Route::SchemeHandler()));
+            webview->RegisterHandler(wxSharedPtr<wxWebViewHandler>(
+                    new Route::SchemeHandler(dispatcher.get())));
             spdlog::debug("Registered custom scheme handler");
         }
 #endif
@@ -126,6 +164,13 @@ namespace CryptoToysPP::Gui {
         webview->AddScriptMessageHandler("CryptoToysPP");
         spdlog::info("Registered script handler: CryptoToysPP");
 
+        // Raw-bytes transport for large payloads, alongside the Base64 path
+        if (webview->AddUserScript(BRIDGE_SCRIPT)) {
+            spdlog::debug("Binary bridge helper injected");
+        } else {
+            spdlog::warn("Binary bridge helper unavailable on this backend");
+        }
+
         webview->Bind(wxEVT_WEBVIEW_ERROR, &MainFrame::OnWebViewError, this);
         webview->Bind(wxEVT_WEBVIEW_LOADED, &MainFrame::OnWebViewLoaded, this);
 
@@ -164,9 +209,12 @@ namespace CryptoToysPP::Gui {
 
             const auto request = nlohmann::json::parse(requestJson);
             requestId = request.value("__id", "");
-            // Routing the request
-            const nlohmann::json response = route.ProcessRequest(request);
-            SendOkResp(requestId, response);
+            // Routing the request on a worker thread; the reply is sent from
+            // there and batched back to the GUI thread
+            dispatcher->Submit(
+                    request, [this, requestId](const nlohmann::json &response) {
+                        SendOkResp(requestId, response);
+                    });
         } catch (const nlohmann::json::parse_error &e) {
             spdlog::error("[{}] JSON parse error: {}", requestId, e.what());
             SendErrResp(requestId,
@@ -198,12 +246,8 @@ namespace CryptoToysPP::Gui {
                       base64Response);
 
         // Sending response
-        const wxString script =
-                wxString::Format("window.rest.resolveInvoke('%s', '%s');",
-                                 base64Response, requestId);
-
-        webview->RunScriptAsync(script);
-        spdlog::debug("[{}] Success response sent", requestId);
+        QueueResponse(requestId, base64Response, true);
+        spdlog::debug("[{}] Success response queued", requestId);
     }
 
     void MainFrame::SendErrResp(const std::string &requestId,
@@ -225,12 +269,43 @@ namespace CryptoToysPP::Gui {
                       base64Response);
 
         // Sending error response
-        const wxString script =
-                wxString::Format("window.rest.rejectInvoke('%s', '%s');",
-                                 base64Response, requestId);
+        QueueResponse(requestId, base64Response, false);
+        spdlog::error("[{}] Error response queued", requestId);
+    }
 
+    void MainFrame::QueueResponse(const std::string &requestId,
+                                  const std::string &base64Response,
+                                  bool success) {
+        bool scheduleFlush;
+        {
+            std::lock_guard lock(responsesMutex);
+            scheduleFlush = pendingResponses.empty();
+            pendingResponses.push_back({requestId, base64Response, success});
+        }
+        // One pending flush picks up everything queued until it runs
+        if (scheduleFlush)
+            CallAfter(&MainFrame::FlushResponses);
+    }
+
+    void MainFrame::FlushResponses() {
+        std::vector<PendingResponse> batch;
+        {
+            std::lock_guard lock(responsesMutex);
+            batch.swap(pendingResponses);
+        }
+        if (batch.empty() || !webview)
+            return;
+
+        wxString script;
+        for (const auto &response : batch) {
+            script += wxString::Format(
+                    response.success
+                            ? "window.rest.resolveInvoke('%s', '%s');"
+                            : "window.rest.rejectInvoke('%s', '%s');",
+                    response.base64Response, response.requestId);
+        }
         webview->RunScriptAsync(script);
-        spdlog::error("[{}] Error response sent", requestId);
+        spdlog::debug("Delivered {} responses to WebView", batch.size());
     }
 
     void MainFrame::OnWebViewError(wxWebViewEvent &evt) {
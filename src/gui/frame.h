@@ -28,6 +28,10 @@
 #ifndef FRAME_H
 #define FRAME_H
 #include "route/route.h"
+#include "route/dispatcher.h"
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <wx/wx.h>
 #include <wx/webview.h>
 namespace CryptoToysPP::Gui {
@@ -35,11 +39,24 @@ namespace CryptoToysPP::Gui {
     private:
         wxWebView *webview = nullptr;
         Route::Route route;
+        // Handlers run on worker threads; must be declared after route
+        std::unique_ptr<Route::Dispatcher> dispatcher;
         static constexpr int WINDOW_WIDTH = 1024;
         static constexpr int WINDOW_HEIGHT = 768;
+
+        // Responses waiting to be delivered to the page in one script
+        struct PendingResponse {
+            std::string requestId;
+            std::string base64Response;
+            bool success;
+        };
+        std::mutex responsesMutex;
+        std::vector<PendingResponse> pendingResponses;
     public:
         MainFrame();
 
+        ~MainFrame() override;
+
         void InitWebView();
 
         void OnScriptMessage(wxWebViewEvent &evt);
@@ -53,6 +70,13 @@ namespace CryptoToysPP::Gui {
                     const nlohmann::json &response);
 
         void SendErrResp(const std::string &requestId, const std::string &message);
+
+        // Thread-safe: queue a response and schedule a flush on the GUI thread
+        void QueueResponse(const std::string &requestId,
+                           const std::string &base64Response,
+                           bool success);
+
+        void FlushResponses();
     };
 } // namespace CryptoToysPP::Gui
 #endif // FRAME_H
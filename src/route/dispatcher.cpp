@@ -0,0 +1,120 @@
+/* clang-format off */
+/*
+ * @file dispatcher.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "dispatcher.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+namespace CryptoToysPP::Route {
+    Dispatcher::Dispatcher(Route &route,
+                           size_t workerCount,
+                           size_t queueCapacity) :
+        route(route), capacity(std::max<size_t>(1, queueCapacity)) {
+        workerCount = std::max<size_t>(1, workerCount);
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.emplace_back(&Dispatcher::WorkerLoop, this);
+        }
+        spdlog::debug("Dispatcher started: {} workers, queue capacity {}",
+                      workerCount, capacity);
+    }
+
+    Dispatcher::~Dispatcher() {
+        Shutdown();
+    }
+
+    size_t Dispatcher::DefaultWorkerCount() {
+        // Leave the GUI thread its own core; a handful of workers is enough
+        // since requests come from a single interactive user
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return std::clamp<size_t>(hardware > 1 ? hardware - 1 : 1, 2, 8);
+    }
+
+    bool Dispatcher::Submit(nlohmann::json request, Callback callback) {
+        {
+            std::lock_guard lock(mutex);
+            if (!stopping && tasks.size() < capacity) {
+                tasks.push_back({std::move(request), std::move(callback)});
+                available.notify_one();
+                return true;
+            }
+        }
+
+        const std::string requestId = request.value("__id", std::string());
+        spdlog::warn("[{}] Request rejected: worker queue is full or stopped "
+                     "(503 Service Unavailable)",
+                     requestId);
+        callback({{"code", 503},
+                  {"message", "Server busy, please retry"},
+                  {"data", nlohmann::json::object()}});
+        return false;
+    }
+
+    void Dispatcher::Shutdown() {
+        {
+            std::lock_guard lock(mutex);
+            if (stopping && workers.empty())
+                return;
+            stopping = true;
+            if (!tasks.empty()) {
+                spdlog::warn("Dispatcher shutdown drops {} queued requests",
+                             tasks.size());
+                tasks.clear();
+            }
+        }
+        available.notify_all();
+        for (auto &worker : workers) {
+            if (worker.joinable())
+                worker.join();
+        }
+        workers.clear();
+        spdlog::debug("Dispatcher stopped");
+    }
+
+    void Dispatcher::WorkerLoop() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock lock(mutex);
+                available.wait(lock, [this] {
+                    return stopping || !tasks.empty();
+                });
+                if (stopping)
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            // ProcessRequest converts handler exceptions into responses
+            nlohmann::json response = route.ProcessRequest(std::move(task.request));
+            try {
+                task.callback(std::move(response));
+            } catch (const std::exception &e) {
+                spdlog::error("Response callback failed: {}", e.what());
+            }
+        }
+    }
+} // namespace CryptoToysPP::Route
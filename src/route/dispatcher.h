@@ -0,0 +1,87 @@
+/* clang-format off */
+/*
+ * @file dispatcher.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef DISPATCHER_H
+#define DISPATCHER_H
+#include "route.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+namespace CryptoToysPP::Route {
+    // Runs Route::ProcessRequest on a fixed set of worker threads so long
+    // running handlers (RSA key generation, large inputs) never block the
+    // caller. The queue is bounded: once full, requests are answered with
+    // 503 straight away instead of piling up.
+    class Dispatcher {
+    public:
+        // Invoked on a worker thread (or the caller, when rejected); the
+        // response is handed over by value so it can be moved from
+        using Callback = std::function<void(nlohmann::json response)>;
+
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY = 64;
+
+        explicit Dispatcher(Route &route,
+                            size_t workerCount = DefaultWorkerCount(),
+                            size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+        ~Dispatcher();
+
+        Dispatcher(const Dispatcher &) = delete;
+
+        Dispatcher &operator=(const Dispatcher &) = delete;
+
+        // Queue a request; returns false if it was rejected with 503
+        bool Submit(nlohmann::json request, Callback callback);
+
+        // Stop accepting requests, drop queued ones and join the workers
+        void Shutdown();
+
+        static size_t DefaultWorkerCount();
+
+    private:
+        struct Task {
+            nlohmann::json request;
+            Callback callback;
+        };
+
+        void WorkerLoop();
+
+        Route &route;
+        const size_t capacity;
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<Task> tasks;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+    };
+} // namespace CryptoToysPP::Route
+
+#endif // DISPATCHER_H
@@ -26,16 +26,115 @@
  */
 /* clang-format on */
 #include "handler.h"
+#include "transport.h"
 #include "resources/resources.h"
 #include <map>
+#include <memory>
+#include <wx/app.h>
 #include <wx/filename.h>
 #include <wx/mstream.h>
 
 namespace CryptoToysPP::Route {
-    SchemeHandler::SchemeHandler() : wxWebViewHandler("app") {
+    namespace {
+        // Response body that owns its bytes; the stream reads them in place
+        class FrameResponseData : public wxWebViewHandlerResponseData {
+        public:
+            explicit FrameResponseData(std::string frame) :
+                frame(std::move(frame)),
+                stream(this->frame.data(), this->frame.size()) {
+            }
+
+            wxInputStream *GetStream() override {
+                return &stream;
+            }
+
+        private:
+            std::string frame;
+            wxMemoryInputStream stream;
+        };
+    } // namespace
+
+    SchemeHandler::SchemeHandler(Dispatcher *dispatcher) :
+        wxWebViewHandler("app"), dispatcher(dispatcher) {
         spdlog::debug("Custom scheme handler initialized for 'app' protocol");
     }
 
+    void SchemeHandler::StartRequest(
+            const wxWebViewHandlerRequest &request,
+            wxSharedPtr<wxWebViewHandlerResponse> response) {
+        if (dispatcher == nullptr ||
+            !request.GetRawURI().StartsWith(BRIDGE_URI)) {
+            wxWebViewHandler::StartRequest(request, response);
+            return;
+        }
+
+        if (request.GetMethod() != "POST") {
+            spdlog::warn("Bridge request with unsupported method: {}",
+                         request.GetMethod().ToStdString());
+            FinishBridgeResponse(response, 405, {});
+            return;
+        }
+
+        nlohmann::json routed;
+        std::string error;
+        if (!Transport::DecodeRequest(ReadRequestBody(request), routed,
+                                      error)) {
+            spdlog::error("Malformed bridge frame: {}", error);
+            FinishBridgeResponse(
+                    response, 400,
+                    Transport::EncodeFrame(
+                            {{"code", 400}, {"message", error}}, {}));
+            return;
+        }
+
+        const std::string requestId = routed.value("__id", std::string());
+        dispatcher->Submit(std::move(routed),
+                           [response, requestId](nlohmann::json result) {
+                               FinishBridgeResponse(
+                                       response, 200,
+                                       Transport::EncodeResponse(
+                                               requestId, std::move(result)));
+                           });
+    }
+
+    std::string
+    SchemeHandler::ReadRequestBody(const wxWebViewHandlerRequest &request) {
+        std::string body;
+        wxInputStream *input = request.GetData();
+        if (input == nullptr)
+            return body;
+
+        const wxFileOffset length = input->GetLength();
+        if (length != wxInvalidOffset && length > 0)
+            body.reserve(static_cast<size_t>(length));
+
+        char buffer[64 * 1024];
+        while (!input->Eof()) {
+            input->Read(buffer, sizeof(buffer));
+            const size_t got = input->LastRead();
+            if (got == 0)
+                break;
+            body.append(buffer, got);
+        }
+        return body;
+    }
+
+    void SchemeHandler::FinishBridgeResponse(
+            const wxSharedPtr<wxWebViewHandlerResponse> &response,
+            int status,
+            std::string frame) {
+        // Responses are completed on the GUI thread, whichever thread
+        // produced them
+        auto data = std::make_shared<std::string>(std::move(frame));
+        wxTheApp->CallAfter([response, status, data] {
+            response->SetStatus(status);
+            response->SetContentType("application/octet-stream");
+            response->SetHeader("Access-Control-Allow-Origin", "*");
+            response->Finish(wxSharedPtr<wxWebViewHandlerResponseData>(
+                    new FrameResponseData(std::move(*data))));
+        });
+    }
+
     wxFSFile *SchemeHandler::GetFile(const wxString &uri) {
         constexpr std::string_view APP_PREFIX = "app://index.html/";
         std::string uriConvert = uri.ToStdString();
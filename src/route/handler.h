@@ -27,6 +27,7 @@
 /* clang-format on */
 #ifndef HANDLER_H
 #define HANDLER_H
+#include "dispatcher.h"
 #include <wx/webview.h>
 #include <wx/filesys.h>
 #include <spdlog/spdlog.h>
@@ -49,11 +50,22 @@ namespace CryptoToysPP::Route {
             std::string message;
         };
 
+        // Routes app://bridge POST bodies (see transport.h); not owned
+        Dispatcher *dispatcher = nullptr;
+
     public:
-        SchemeHandler();
+        static constexpr const char *BRIDGE_URI = "app://bridge";
+
+        explicit SchemeHandler(Dispatcher *dispatcher = nullptr);
 
         wxFSFile *GetFile(const wxString &uri) override;
 
+        // Binary bridge requests are answered asynchronously from the worker
+        // pool; everything else falls back to GetFile
+        void StartRequest(const wxWebViewHandlerRequest &request,
+                          wxSharedPtr<wxWebViewHandlerResponse> response)
+                override;
+
     private:
         // Resource path security validation function
         static ValidationResult ValidateResourcePath(const wxString &uri);
@@ -70,6 +82,14 @@ namespace CryptoToysPP::Route {
                                  const ResourceDescriptor &descriptor);
 
         static wxString GetMimeType(const std::string &path);
+
+        static std::string ReadRequestBody(
+                const wxWebViewHandlerRequest &request);
+
+        static void FinishBridgeResponse(
+                const wxSharedPtr<wxWebViewHandlerResponse> &response,
+                int status,
+                std::string frame);
     };
 } // namespace CryptoToysPP::Route
 
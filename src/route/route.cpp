@@ -38,11 +38,43 @@
 #include "algorithm/simple/uucode.h"
 #include "algorithm/simple/xxcode.h"
 #include "algorithm/simple/vigenere.h"
-#include "algorithm/hash/hash.h"
+#include "algorithm/hash/hasher.h"
+#include "algorithm/hash/multi_hasher.h"
+#include "algorithm/hash/file_hash.h"
+#include "algorithm/hash/batch_hash.h"
+#include "algorithm/hash/tree_hash.h"
+#include "algorithm/hash/hmac.h"
 #include "algorithm/advance/aes.h"
 #include "algorithm/advance/rsa.h"
+#include "algorithm/common/hex.h"
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
 #include <spdlog/spdlog.h>
 namespace CryptoToysPP::Route {
+    namespace {
+        // The string stored under `name` without copying it (inputs can be
+        // megabytes); "" when the field is missing
+        const std::string &StringField(const nlohmann::json &data,
+                                       const char *name) {
+            static const std::string empty;
+            const auto it = data.find(name);
+            if (it == data.end())
+                return empty;
+            return it->get_ref<const std::string &>();
+        }
+
+        // Paths come from the web page, which must not make a worker block
+        // on a FIFO or read a device that never ends
+        void RequireRegularFile(const std::string &path) {
+            std::error_code error;
+            if (path.empty() || path == "-")
+                throw BadRequest("A file path is required");
+            if (!std::filesystem::is_regular_file(path, error))
+                throw BadRequest("Not a regular file: " + path);
+        }
+    } // namespace
+
     Route::Route() {
         spdlog::debug("Initializing route handlers...");
 
@@ -62,6 +94,21 @@ namespace CryptoToysPP::Route {
         Add("POST", "/api/hash/encode", [this](const nlohmann::json &data) {
             return HashEncode(data);
         });
+        Add("POST", "/api/hash/multi", [this](const nlohmann::json &data) {
+            return HashMulti(data);
+        });
+        Add("POST", "/api/hash/file", [this](const nlohmann::json &data) {
+            return HashFile(data);
+        });
+        Add("POST", "/api/hash/batch", [this](const nlohmann::json &data) {
+            return HashBatch(data);
+        });
+        Add("POST", "/api/hash/tree", [this](const nlohmann::json &data) {
+            return HashTree(data);
+        });
+        Add("POST", "/api/hash/hmac", [this](const nlohmann::json &data) {
+            return HashHmac(data);
+        });
         Add("POST", "/api/aes/encrypt", [this](const nlohmann::json &data) {
             return AesEncrypt(data);
         });
@@ -82,7 +129,7 @@ namespace CryptoToysPP::Route {
     nlohmann::json Route::BaseEncode(const nlohmann::json &data) {
         std::string encoded;
         const int bits = data.value("bits", 0);
-        const std::string inputText = data.value("inputText", std::string());
+        const std::string &inputText = StringField(data, "inputText");
         switch (bits) {
             case 16:
                 encoded = Algorithm::Base::Base16::Encode(inputText);
@@ -90,6 +137,19 @@ namespace CryptoToysPP::Route {
             case 32:
                 encoded = Algorithm::Base::Base32::Encode(inputText);
                 break;
+            case 3232:
+                encoded = Algorithm::Base::Base32::Encode(
+                        inputText, Algorithm::Base::Base32::Alphabet::HEX);
+                break;
+            case 3233:
+                encoded = Algorithm::Base::Base32::Encode(
+                        inputText,
+                        Algorithm::Base::Base32::Alphabet::CROCKFORD);
+                break;
+            case 3234:
+                encoded = Algorithm::Base::Base32::Encode(
+                        inputText, Algorithm::Base::Base32::Alphabet::ZBASE32);
+                break;
             case 58:
                 encoded = Algorithm::Base::Base58::Encode(inputText);
                 break;
@@ -105,6 +165,12 @@ namespace CryptoToysPP::Route {
             case 85:
                 encoded = Algorithm::Base::Base85::Encode(inputText);
                 break;
+            case 8585:
+                encoded = Algorithm::Base::Base85::EncodeZ85(inputText);
+                break;
+            case 8586:
+                encoded = Algorithm::Base::Base85::EncodeAscii85(inputText);
+                break;
             case 91:
                 encoded = Algorithm::Base::Base91::Encode(inputText);
                 break;
@@ -123,7 +189,7 @@ namespace CryptoToysPP::Route {
     nlohmann::json Route::BaseDecode(const nlohmann::json &data) {
         std::string decoded;
         const int bits = data.value("bits", 0);
-        const std::string inputText = data.value("inputText", std::string());
+        const std::string &inputText = StringField(data, "inputText");
         switch (bits) {
             case 16:
                 decoded = Algorithm::Base::Base16::Decode(inputText);
@@ -131,6 +197,19 @@ namespace CryptoToysPP::Route {
             case 32:
                 decoded = Algorithm::Base::Base32::Decode(inputText);
                 break;
+            case 3232:
+                decoded = Algorithm::Base::Base32::Decode(
+                        inputText, Algorithm::Base::Base32::Alphabet::HEX);
+                break;
+            case 3233:
+                decoded = Algorithm::Base::Base32::Decode(
+                        inputText,
+                        Algorithm::Base::Base32::Alphabet::CROCKFORD);
+                break;
+            case 3234:
+                decoded = Algorithm::Base::Base32::Decode(
+                        inputText, Algorithm::Base::Base32::Alphabet::ZBASE32);
+                break;
             case 58:
                 decoded = Algorithm::Base::Base58::Decode(inputText);
                 break;
@@ -146,6 +225,12 @@ namespace CryptoToysPP::Route {
             case 85:
                 decoded = Algorithm::Base::Base85::Decode(inputText);
                 break;
+            case 8585:
+                decoded = Algorithm::Base::Base85::DecodeZ85(inputText);
+                break;
+            case 8586:
+                decoded = Algorithm::Base::Base85::DecodeAscii85(inputText);
+                break;
             case 91:
                 decoded = Algorithm::Base::Base91::Decode(inputText);
                 break;
@@ -164,7 +249,7 @@ namespace CryptoToysPP::Route {
     nlohmann::json Route::SimpleEncode(const nlohmann::json &data) {
         std::string encoded;
         const std::string whichCode = data.value("whichCode", std::string());
-        const std::string inputText = data.value("inputText", std::string());
+        const std::string &inputText = StringField(data, "inputText");
         if (whichCode == "uu") {
             encoded = Algorithm::Simple::UUCode::Encode(inputText);
         } else if (whichCode == "xx") {
@@ -179,7 +264,7 @@ namespace CryptoToysPP::Route {
     nlohmann::json Route::SimpleDecode(const nlohmann::json &data) {
         std::string decoded;
         const std::string whichCode = data.value("whichCode", std::string());
-        const std::string inputText = data.value("inputText", std::string());
+        const std::string &inputText = StringField(data, "inputText");
         if (whichCode == "uu") {
             decoded = Algorithm::Simple::UUCode::Decode(inputText);
         } else if (whichCode == "xx") {
@@ -194,37 +279,148 @@ namespace CryptoToysPP::Route {
     nlohmann::json Route::HashEncode(const nlohmann::json &data) {
         std::string encoded;
         const std::string whichCode = data.value("whichCode", std::string());
-        const std::string inputText = data.value("inputText", std::string());
-        if (whichCode == "md2") {
-            encoded = Algorithm::Hash::MD2(inputText);
-        } else if (whichCode == "md4") {
-            encoded = Algorithm::Hash::MD4(inputText);
-        } else if (whichCode == "md5") {
-            encoded = Algorithm::Hash::MD5(inputText);
-        } else if (whichCode == "sha1") {
-            encoded = Algorithm::Hash::SHA1(inputText);
-        } else if (whichCode == "sha224") {
-            encoded = Algorithm::Hash::SHA224(inputText);
-        } else if (whichCode == "sha256") {
-            encoded = Algorithm::Hash::SHA256(inputText);
-        } else if (whichCode == "sha384") {
-            encoded = Algorithm::Hash::SHA384(inputText);
-        } else if (whichCode == "sha512") {
-            encoded = Algorithm::Hash::SHA512(inputText);
-        } else if (whichCode == "sha3-224") {
-            encoded = Algorithm::Hash::SHA3_224(inputText);
-        } else if (whichCode == "sha3-256") {
-            encoded = Algorithm::Hash::SHA3_256(inputText);
-        } else if (whichCode == "sha3-384") {
-            encoded = Algorithm::Hash::SHA3_384(inputText);
-        } else if (whichCode == "sha3-512") {
-            encoded = Algorithm::Hash::SHA3_512(inputText);
+        const std::string &inputText = StringField(data, "inputText");
+        const auto type = Algorithm::Hash::Hasher::StringToType(whichCode);
+        if (type != Algorithm::Hash::Hasher::Type::UNKNOWN) {
+            encoded = hashCache.HexDigest(type, inputText);
         }
         return encoded;
     }
 
+    // {"algorithms": ["md5", "sha256", ...], "inputText": ...} returns an
+    // object mapping each name to its digest, all computed in one pass
+    nlohmann::json Route::HashMulti(const nlohmann::json &data) {
+        const std::string &inputText = StringField(data, "inputText");
+        const auto names =
+                data.value("algorithms", std::vector<std::string>());
+        std::vector<Algorithm::Hash::Hasher::Type> types;
+        for (const auto &name : names) {
+            const auto type = Algorithm::Hash::Hasher::StringToType(name);
+            if (type == Algorithm::Hash::Hasher::Type::UNKNOWN)
+                throw std::invalid_argument("Unknown hash algorithm: " + name);
+            types.push_back(type);
+        }
+        const std::vector<std::string> digests =
+                Algorithm::Hash::MultiHasher::HexDigests(types, inputText);
+        nlohmann::json result = nlohmann::json::object();
+        for (size_t i = 0; i < names.size(); ++i)
+            result[names[i]] = digests[i];
+        return result;
+    }
+
+    // {"path": ..., "algorithms": [...]} hashes a file on disk without
+    // sending its content through the bridge; "whichCode" may name a
+    // single algorithm instead
+    nlohmann::json Route::HashFile(const nlohmann::json &data) {
+        const std::string path = data.value("path", std::string());
+        RequireRegularFile(path);
+        auto names = data.value("algorithms", std::vector<std::string>());
+        if (names.empty())
+            names.push_back(data.value("whichCode", std::string()));
+        std::vector<Algorithm::Hash::Hasher::Type> types;
+        for (const auto &name : names) {
+            const auto type = Algorithm::Hash::Hasher::StringToType(name);
+            if (type == Algorithm::Hash::Hasher::Type::UNKNOWN)
+                throw std::invalid_argument("Unknown hash algorithm: " + name);
+            types.push_back(type);
+        }
+        // Read rather than mapped: a file truncated while it is hashed
+        // (log rotation, a download in progress) would raise SIGBUS in
+        // the GUI process
+        const Algorithm::Hash::FileDigests result = Algorithm::Hash::HashFile(
+                path, types, Algorithm::Common::FileSource::Access::READ);
+        nlohmann::json digests = nlohmann::json::object();
+        for (size_t i = 0; i < names.size(); ++i)
+            digests[names[i]] = result.digests[i];
+        return {{"digests", digests},
+                {"bytes", result.bytes},
+                {"seconds", result.seconds},
+                {"bytesPerSecond", result.bytesPerSecond}};
+    }
+
+    // {"whichCode": ..., "messages": [...]} returns the digest of every
+    // message, in order
+    nlohmann::json Route::HashBatch(const nlohmann::json &data) {
+        const std::string whichCode = data.value("whichCode", std::string());
+        const auto type = Algorithm::Hash::Hasher::StringToType(whichCode);
+        if (type == Algorithm::Hash::Hasher::Type::UNKNOWN)
+            throw std::invalid_argument("Unknown hash algorithm: " +
+                                        whichCode);
+        const auto messages =
+                data.value("messages", std::vector<std::string>());
+        const std::vector<std::string_view> views(messages.begin(),
+                                                  messages.end());
+        return Algorithm::Hash::BatchHexDigest(type, views);
+    }
+
+    // {"whichCode": ..., "path" or "inputText": ...} returns the Merkle
+    // root and the leaf hashes, so the caller can verify ranges later
+    nlohmann::json Route::HashTree(const nlohmann::json &data) {
+        const std::string whichCode = data.value("whichCode", std::string());
+        const auto type = Algorithm::Hash::Hasher::StringToType(whichCode);
+        if (type == Algorithm::Hash::Hasher::Type::UNKNOWN)
+            throw std::invalid_argument("Unknown hash algorithm: " +
+                                        whichCode);
+        const std::string path = data.value("path", std::string());
+        Algorithm::Hash::TreeHash::Result result;
+        if (!path.empty()) {
+            RequireRegularFile(path);
+            // Read rather than mapped, as in HashFile
+            result = Algorithm::Hash::TreeHash::HashFile(
+                    type, path, Algorithm::Common::FileSource::Access::READ);
+        } else {
+            Algorithm::Hash::TreeHash tree(type);
+            tree.Update(StringField(data, "inputText"));
+            result = tree.Final();
+        }
+        std::vector<std::string> leaves;
+        leaves.reserve(result.LeafCount());
+        for (size_t i = 0; i < result.LeafCount(); ++i)
+            leaves.push_back(Algorithm::Common::HexEncode(
+                    result.Leaf(i), Algorithm::Common::HexCase::LOWER));
+        return {{"root",
+                 Algorithm::Common::HexEncode(
+                         result.root, Algorithm::Common::HexCase::LOWER)},
+                {"leafSize", Algorithm::Hash::TreeHash::LEAF_SIZE},
+                {"bytes", result.bytes},
+                {"leaves", leaves}};
+    }
+
+    // {"whichCode": ..., "key": ..., "keyFormat": "hex"?, "inputText": ...}
+    // returns the hex tag; "messages": [...] instead of "inputText" returns
+    // one tag per message under the same key. An empty key is rejected
+    // unless "allowEmptyKey" is true.
+    nlohmann::json Route::HashHmac(const nlohmann::json &data) {
+        const std::string whichCode = data.value("whichCode", std::string());
+        const auto type = Algorithm::Hash::Hasher::StringToType(whichCode);
+        if (type == Algorithm::Hash::Hasher::Type::UNKNOWN)
+            throw std::invalid_argument("Unknown hash algorithm: " +
+                                        whichCode);
+        const std::string keyFormat = data.value("keyFormat", std::string());
+        std::string key = data.value("key", std::string());
+        if (keyFormat == "hex") {
+            // A mistyped key must not silently become the empty key
+            auto decoded = Algorithm::Common::HexDecode(key);
+            if (!decoded)
+                throw std::invalid_argument("Invalid hex key");
+            key = std::move(*decoded);
+        }
+        if (key.empty() && !data.value("allowEmptyKey", false))
+            throw std::invalid_argument(
+                    "HMAC key is empty (set allowEmptyKey to use one)");
+        if (data.contains("messages")) {
+            const auto messages =
+                    data.value("messages", std::vector<std::string>());
+            const std::vector<std::string_view> views(messages.begin(),
+                                                      messages.end());
+            return Algorithm::Hash::Hmac::BatchHexDigest(type, key, views);
+        }
+        return Algorithm::Hash::Hmac::HexDigest(
+                type, key, StringField(data, "inputText"));
+    }
+
     nlohmann::json Route::AesEncrypt(const nlohmann::json &data) {
-        const std::string plaintext = data.value("inputText", std::string());
+        const std::string &plaintext = StringField(data, "inputText");
         const std::string keyFormat = data.value("keyFormat", std::string());
         const std::string key = (keyFormat == "hex")
                 ? Algorithm::Advance::AES::HexToString(
@@ -258,7 +454,7 @@ namespace CryptoToysPP::Route {
     }
 
     nlohmann::json Route::AesDecrypt(const nlohmann::json &data) {
-        const std::string ciphertext = data.value("inputText", std::string());
+        const std::string &ciphertext = StringField(data, "inputText");
         const std::string keyFormat = data.value("keyFormat", std::string());
         const std::string key = (keyFormat == "hex")
                 ? Algorithm::Advance::AES::HexToString(
@@ -352,6 +548,7 @@ namespace CryptoToysPP::Route {
                     const std::string &path,
                     const HandlerFunc &handler) {
         const auto key = std::make_pair(method, path);
+        std::unique_lock lock(routesMutex);
         if (routes.contains(key)) {
             spdlog::warn("Duplicate route handler registered for: {} - {}",
                          method, path);
@@ -360,7 +557,7 @@ namespace CryptoToysPP::Route {
         spdlog::debug("Registered handler for {} - {}", method, path);
     }
 
-    nlohmann::json Route::ProcessRequest(const nlohmann::json &request) {
+    nlohmann::json Route::ProcessRequest(nlohmann::json request) {
         if (!request.is_object()) {
             spdlog::error("Invalid request: must be a JSON object");
             return MakeErrResp(400, "Invalid request format");
@@ -384,11 +581,18 @@ namespace CryptoToysPP::Route {
         try {
             const std::string method = request.value("method", std::string());
             const std::string path = request.value("path", std::string());
-            // Extract request data
-            const nlohmann::json data =
-                    request.value("data", nlohmann::json::object());
-            spdlog::info("[{}] Processing request for {} - {} : {}", requestId,
-                         method, path, data.dump());
+            // Extract request data; it may hold megabytes of input, so it
+            // is moved out rather than copied
+            nlohmann::json data = nlohmann::json::object();
+            if (const auto it = request.find("data"); it != request.end())
+                data = std::move(*it);
+            // Only sizes at info level; full dumps of possibly binary
+            // inputs (invalid UTF-8 replaced) are for debugging
+            spdlog::info("[{}] Processing request for {} - {} : {} bytes",
+                         requestId, method, path, PayloadSize(data));
+            if (spdlog::should_log(spdlog::level::debug))
+                spdlog::debug("[{}] Request data: {}", requestId,
+                              DumpForLog(data));
             // API rate limiting
             if (!CheckRateLimit(path)) {
                 spdlog::warn("[{}] Rate limit exceeded for {} - {} (429 Too "
@@ -397,16 +601,29 @@ namespace CryptoToysPP::Route {
                 return MakeErrResp(429, "Too many requests");
             }
             // Route dispatch
-            const auto key = std::make_pair(method, path);
-            if (!routes.contains(key)) {
+            HandlerFunc handler;
+            {
+                std::shared_lock lock(routesMutex);
+                const auto it = routes.find(std::make_pair(method, path));
+                if (it != routes.end())
+                    handler = it->second;
+            }
+            if (!handler) {
                 spdlog::warn("[{}] API endpoint not found: {} - {}", requestId,
                              method, path);
                 return MakeErrResp(404, "API endpoint not found");
             }
-            const auto response = routes[key](data);
-            spdlog::info("[{}] Successfully processed {} - {} : {}", requestId,
-                         method, path, response.dump());
-            return MakeOkResp(200, response);
+            // Run the handler outside the lock so requests proceed in parallel
+            nlohmann::json response = handler(data);
+            spdlog::info("[{}] Successfully processed {} - {} : {} bytes",
+                         requestId, method, path, PayloadSize(response));
+            if (spdlog::should_log(spdlog::level::debug))
+                spdlog::debug("[{}] Response data: {}", requestId,
+                              DumpForLog(response));
+            return MakeOkResp(200, std::move(response));
+        } catch (const BadRequest &e) {
+            spdlog::warn("[{}] Bad request: {}", requestId, e.what());
+            return MakeErrResp(400, e.what());
         } catch (const std::exception &e) {
             spdlog::error("[{}] Request processing error: {}", requestId,
                           e.what());
@@ -420,6 +637,7 @@ namespace CryptoToysPP::Route {
 
     bool Route::CheckRateLimit(const std::string &path) {
         auto now = std::chrono::steady_clock::now();
+        std::lock_guard lock(rateLimitsMutex);
         auto &timePoints = rateLimits[path]; // Automatically create new queue
 
         // Expire outdated records (fixed type issue)
@@ -440,8 +658,26 @@ namespace CryptoToysPP::Route {
         return true;
     }
 
-    nlohmann::json Route::MakeOkResp(int code, const nlohmann::json &data) {
-        return {{"code", code}, {"message", std::string()}, {"data", data}};
+    std::string Route::DumpForLog(const nlohmann::json &value) {
+        return value.dump(-1, ' ', false,
+                          nlohmann::json::error_handler_t::replace);
+    }
+
+    size_t Route::PayloadSize(const nlohmann::json &value) {
+        if (value.is_string())
+            return value.get_ref<const std::string &>().size();
+        size_t size = 0;
+        if (value.is_structured()) {
+            for (const auto &item : value)
+                size += PayloadSize(item);
+        }
+        return size;
+    }
+
+    nlohmann::json Route::MakeOkResp(int code, nlohmann::json data) {
+        nlohmann::json response = {{"code", code}, {"message", std::string()}};
+        response["data"] = std::move(data);
+        return response;
     }
 
     nlohmann::json Route::MakeErrResp(int code, const std::string &message) {
@@ -30,9 +30,20 @@
 #include <queue>
 #include <chrono>
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
 #include <nlohmann/json.hpp>
+#include "algorithm/hash/prefix_hash_cache.h"
 namespace CryptoToysPP::Route {
     using HandlerFunc = std::function<nlohmann::json(const nlohmann::json &)>;
+
+    // Thrown by handlers for requests they refuse; answered with 400
+    class BadRequest : public std::invalid_argument {
+    public:
+        using std::invalid_argument::invalid_argument;
+    };
+
     struct PairHash {
         size_t operator()(const std::pair<std::string, std::string> &p) const {
             // Use golden ratio constant for hash combination
@@ -52,12 +63,18 @@ namespace CryptoToysPP::Route {
                            HandlerFunc,
                            PairHash>
                 routes;
+        // Guards routes: lookups are shared, registration is exclusive
+        mutable std::shared_mutex routesMutex;
         // 限流设置
         static constexpr int MAX_REQUESTS = 100;
         static constexpr auto TIME_WINDOW = std::chrono::seconds(1);
         std::unordered_map<std::string,
                            std::queue<std::chrono::steady_clock::time_point>>
                 rateLimits{};
+        std::mutex rateLimitsMutex;
+        // Hash page inputs grow a keystroke at a time; only new tails are
+        // hashed
+        Algorithm::Hash::PrefixHashCache hashCache;
 
     public:
         Route();
@@ -72,6 +89,16 @@ namespace CryptoToysPP::Route {
 
         nlohmann::json HashEncode(const nlohmann::json &data);
 
+        nlohmann::json HashMulti(const nlohmann::json &data);
+
+        nlohmann::json HashFile(const nlohmann::json &data);
+
+        nlohmann::json HashBatch(const nlohmann::json &data);
+
+        nlohmann::json HashTree(const nlohmann::json &data);
+
+        nlohmann::json HashHmac(const nlohmann::json &data);
+
         nlohmann::json AesEncrypt(const nlohmann::json &data);
 
         nlohmann::json AesDecrypt(const nlohmann::json &data);
@@ -86,12 +113,19 @@ namespace CryptoToysPP::Route {
                  const std::string &path,
                  const HandlerFunc &handler);
 
-        nlohmann::json ProcessRequest(const nlohmann::json &request);
+        // Thread-safe: may be called concurrently from worker threads. The
+        // request is consumed so large inputs are moved, not copied.
+        nlohmann::json ProcessRequest(nlohmann::json request);
 
     private:
         bool CheckRateLimit(const std::string &path);
 
-        nlohmann::json MakeOkResp(int code, const nlohmann::json &data);
+        static std::string DumpForLog(const nlohmann::json &value);
+
+        // Total bytes of the strings in value, for size-only logging
+        static size_t PayloadSize(const nlohmann::json &value);
+
+        nlohmann::json MakeOkResp(int code, nlohmann::json data);
 
         nlohmann::json MakeErrResp(int code, const std::string &message);
     };
@@ -0,0 +1,131 @@
+/* clang-format off */
+/*
+ * @file transport.cpp
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#include "transport.h"
+#include <utility>
+#include <spdlog/spdlog.h>
+namespace CryptoToysPP::Route {
+    bool Transport::SplitFrame(std::string_view frame,
+                               std::string_view &metadata,
+                               std::string_view &payload,
+                               std::string &error) {
+        if (frame.size() < HEADER_SIZE) {
+            error = "Frame too short";
+            return false;
+        }
+
+        const auto *bytes = reinterpret_cast<const uint8_t *>(frame.data());
+        const size_t length = static_cast<size_t>(bytes[0]) |
+                (static_cast<size_t>(bytes[1]) << 8) |
+                (static_cast<size_t>(bytes[2]) << 16) |
+                (static_cast<size_t>(bytes[3]) << 24);
+        if (length > MAX_METADATA_SIZE ||
+            length > frame.size() - HEADER_SIZE) {
+            error = "Invalid metadata length";
+            return false;
+        }
+
+        metadata = frame.substr(HEADER_SIZE, length);
+        payload = frame.substr(HEADER_SIZE + length);
+        return true;
+    }
+
+    bool Transport::DecodeRequest(std::string frame,
+                                  nlohmann::json &request,
+                                  std::string &error) {
+        std::string_view metadata;
+        std::string_view payload;
+        if (!SplitFrame(frame, metadata, payload, error))
+            return false;
+
+        request = nlohmann::json::parse(metadata, nullptr, false);
+        if (request.is_discarded() || !request.is_object()) {
+            error = "Metadata must be a JSON object";
+            return false;
+        }
+
+        auto &data = request["data"];
+        if (data.is_null())
+            data = nlohmann::json::object();
+        if (!data.is_object()) {
+            error = "Field 'data' must be an object";
+            return false;
+        }
+
+        const std::string field =
+                request.value("payloadField", DEFAULT_PAYLOAD_FIELD);
+        request.erase("payloadField");
+        spdlog::debug("[{}] Bridge request: {} metadata bytes, {} payload "
+                      "bytes",
+                      request.value("__id", std::string()), metadata.size(),
+                      payload.size());
+
+        // Drop the header and metadata in place and hand the buffer over
+        frame.erase(0, frame.size() - payload.size());
+        data[field] = std::move(frame);
+        return true;
+    }
+
+    std::string Transport::EncodeResponse(const std::string &requestId,
+                                          nlohmann::json response) {
+        nlohmann::json metadata = {
+                {"__id", requestId},
+                {"code", response.value("code", 500)},
+                {"message", response.value("message", std::string())},
+                {"payload", false}};
+
+        auto &data = response["data"];
+        if (data.is_string()) {
+            // Hand the result over as raw bytes, no escaping or re-encoding
+            const std::string payload =
+                    std::move(data.get_ref<std::string &>());
+            metadata["payload"] = true;
+            metadata["data"] = nullptr;
+            return EncodeFrame(metadata, payload);
+        }
+
+        metadata["data"] = std::move(data);
+        return EncodeFrame(metadata, {});
+    }
+
+    std::string Transport::EncodeFrame(const nlohmann::json &metadata,
+                                       std::string_view payload) {
+        const std::string json = metadata.dump(
+                -1, ' ', false, nlohmann::json::error_handler_t::replace);
+        const auto length = static_cast<uint32_t>(json.size());
+
+        std::string frame;
+        frame.reserve(HEADER_SIZE + json.size() + payload.size());
+        frame.push_back(static_cast<char>(length & 0xFF));
+        frame.push_back(static_cast<char>((length >> 8) & 0xFF));
+        frame.push_back(static_cast<char>((length >> 16) & 0xFF));
+        frame.push_back(static_cast<char>((length >> 24) & 0xFF));
+        frame.append(json);
+        frame.append(payload);
+        return frame;
+    }
+} // namespace CryptoToysPP::Route
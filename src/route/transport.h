@@ -0,0 +1,77 @@
+/* clang-format off */
+/*
+ * @file transport.h
+ * @date 2026-10-16
+ * @license MIT License
+ *
+ * Copyright (c) 2025 BinRacer <native.lab@outlook.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/* clang-format on */
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+namespace CryptoToysPP::Route {
+    // Binary framing for the app://bridge endpoint. Large inputs and outputs
+    // travel as raw bytes; only the small metadata object is JSON.
+    //
+    //   offset 0   uint32 little-endian  metadata length N
+    //   offset 4   N bytes               metadata JSON (UTF-8)
+    //   offset 4+N remaining bytes       raw payload
+    //
+    // Request metadata: {"__id", "method", "path", "data", "payloadField"}.
+    // The payload is stored as data[payloadField] (default "inputText")
+    // before the request is routed.
+    //
+    // Response metadata: {"__id", "code", "message", "data", "payload"}.
+    // A string result is moved into the payload and "payload" is true;
+    // any other result stays in "data" and the payload is empty.
+    class Transport {
+    public:
+        static constexpr size_t HEADER_SIZE = 4;
+        static constexpr size_t MAX_METADATA_SIZE = 1 << 20;
+        static constexpr const char *DEFAULT_PAYLOAD_FIELD = "inputText";
+
+        // Build a routable request from a frame; false with error on
+        // malformed input. The frame's buffer becomes the payload string,
+        // so the payload is not copied.
+        static bool DecodeRequest(std::string frame,
+                                  nlohmann::json &request,
+                                  std::string &error);
+
+        // Frame a ProcessRequest response for the request with requestId
+        static std::string EncodeResponse(const std::string &requestId,
+                                          nlohmann::json response);
+
+        static std::string EncodeFrame(const nlohmann::json &metadata,
+                                       std::string_view payload);
+
+    private:
+        static bool SplitFrame(std::string_view frame,
+                               std::string_view &metadata,
+                               std::string_view &payload,
+                               std::string &error);
+    };
+} // namespace CryptoToysPP::Route
+
+#endif // TRANSPORT_H